@@ -8,15 +8,81 @@
 
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/string/string.h>
 
 namespace FirstPersonController
 {
+    // Stages the system component runs every frame, in this order, across all characters
+    enum class FrameStage : AZ::u8
+    {
+        // Input is applied and the character and camera orientation are simulated
+        Controller,
+        // Jump queueing, sprint field of view and headbob react to the simulated character
+        Extras,
+        // Each camera's pose is written once
+        CameraCompose,
+        // Entities coupled to the camera follow its final pose
+        Attachments,
+        Count
+    };
+
+    // Ticks that run the controllers outside the frame stages, whose scene queries are also batched across characters
+    enum class TickStage : AZ::u8
+    {
+        // Start of each physics simulation step, for characters adding their velocity on the physics timestep
+        PhysicsTimestep,
+        // NetworkFPC input processing, batched once per frame
+        NetworkTick,
+        Count
+    };
+
+    // Stages timed by fpc_Benchmark, each one also a profiler scope
+    enum class BenchmarkStage : AZ::u8
+    {
+        ProcessInput,
+        UpdateRotation,
+        LerpCameraToCharacter,
+        ResetCameraToCharacter,
+        ApplyMovingUpInclineXYSpeedFactor,
+        SprintManager,
+        CrouchManager,
+        UpdateVelocityXY,
+        AcquireSumOfGroundNormals,
+        CheckCharacterMovementObstructed,
+        CheckGrounded,
+        UpdateVelocityZ,
+        ProcessLinearImpulse,
+        ProcessCharacterHits,
+        GetNetworkFPCProperties,
+        SetNetworkFPCProperties,
+        ExtrasProcessInput,
+        ExtrasUpdateHeadbob,
+        NetworkFPCCreateInput,
+        NetworkFPCProcessInput,
+        Count
+    };
+
+    class FrameStageHandler;
+
     class FirstPersonControllerRequests
     {
     public:
         AZ_RTTI(FirstPersonControllerRequests, FirstPersonControllerRequestsTypeId);
         virtual ~FirstPersonControllerRequests() = default;
-        // Put your public methods here
+
+        // Benchmark of the controllers' per-stage and per-frame cost, started with fpc_Benchmark
+        virtual void StartBenchmark(const AZ::u32 frames, const AZStd::string& outputPath) = 0;
+        virtual bool GetBenchmarkRunning() const = 0;
+        virtual void BeginBenchmarkStage() = 0;
+        virtual void EndBenchmarkStage(const BenchmarkStage stage, const float milliseconds) = 0;
+        virtual void RecordBenchmarkSceneQueries(const AZ::u32 sceneQueries) = 0;
+
+        // Per-frame stage graph, handlers run in the order they were added within a stage
+        virtual void AddFrameStageHandler(const FrameStage stage, FrameStageHandler* handler) = 0;
+        virtual void RemoveFrameStageHandler(const FrameStage stage, FrameStageHandler* handler) = 0;
+        // Called by each character as it starts a tick stage, the first call of each physics step or frame queues and submits every
+        // frame stage handler's queries for it
+        virtual void BeginTickStage(const TickStage stage) = 0;
     };
 
     class FirstPersonControllerBusTraits : public AZ::EBusTraits
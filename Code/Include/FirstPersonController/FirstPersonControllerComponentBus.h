@@ -207,6 +207,10 @@ namespace FirstPersonController
         virtual void SetCharacterHitBy(const AzPhysics::SceneQuery::QueryType&) = 0;
         virtual AZStd::vector<AZ::EntityId> GetCharacterHitEntityIds() const = 0;
         virtual AZStd::vector<AzPhysics::SceneQueryHit> GetCharacterSceneQueryHits() const = 0;
+        virtual bool GetCharacterHitsAdaptive() const = 0;
+        virtual void SetCharacterHitsAdaptive(const bool) = 0;
+        virtual AZ::u16 GetCharacterHitsIdleSweepInterval() const = 0;
+        virtual void SetCharacterHitsIdleSweepInterval(const AZ::u16) = 0;
         virtual float GetJumpInitialVelocity() const = 0;
         virtual void SetJumpInitialVelocity(const float) = 0;
         virtual float GetJumpSecondInitialVelocity() const = 0;
@@ -419,6 +423,12 @@ namespace FirstPersonController
         virtual void SetCameraPitchMinAngleDegrees(const float) = 0;
         virtual float GetCameraRotationDampFactor() const = 0;
         virtual void SetCameraRotationDampFactor(const float) = 0;
+        virtual bool GetRawMouseLook() const = 0;
+        virtual void SetRawMouseLook(const bool) = 0;
+        virtual bool GetRawMouseLookSubFrameInterpolation() const = 0;
+        virtual void SetRawMouseLookSubFrameInterpolation(const bool) = 0;
+        virtual float GetInputToCameraLatency() const = 0;
+        virtual float GetInputToCameraLatencyMax() const = 0;
         virtual AZ::TransformInterface* GetCharacterTransformInterfacePtr() const = 0;
         virtual AZ::Transform GetCharacterTransform() const = 0;
         virtual void SetCharacterTransform(const AZ::Transform&) = 0;
@@ -455,6 +465,33 @@ namespace FirstPersonController
         virtual void SetLocallyEnableNetworkFPC(const bool) = 0;
         virtual bool GetIsNetworkingActive() const = 0;
         virtual void IgnoreInputs(const bool) = 0;
+        virtual bool StartInputRecording(const AZStd::string&) = 0;
+        virtual bool StartInputReplay(const AZStd::string&) = 0;
+        virtual void StopInputTrace() = 0;
+        virtual bool GetInputRecording() const = 0;
+        virtual bool GetInputReplaying() const = 0;
+        virtual AZ::u32 GetTickSceneQueryCount() const = 0;
+        virtual AZ::u32 GetTickHitsProcessedCount() const = 0;
+        virtual AZ::u32 GetTickHitsDiscardedCount() const = 0;
+        virtual AZ::u32 GetTickBusEventCount() const = 0;
+        virtual AZ::s64 GetTickAllocatedBytes() const = 0;
+        virtual bool GetEnableIdleSleep() const = 0;
+        virtual void SetEnableIdleSleep(const bool) = 0;
+        virtual AZ::u16 GetIdleSleepQuietTicks() const = 0;
+        virtual void SetIdleSleepQuietTicks(const AZ::u16) = 0;
+        virtual bool GetIdleSleeping() const = 0;
+        virtual void WakeFromIdleSleep() = 0;
+        virtual bool GetEnableGroundQueryCache() const = 0;
+        virtual void SetEnableGroundQueryCache(const bool) = 0;
+        virtual float GetGroundQueryCacheMoveFraction() const = 0;
+        virtual void SetGroundQueryCacheMoveFraction(const float) = 0;
+        virtual AZ::u16 GetGroundQueryCacheRefreshTicks() const = 0;
+        virtual void SetGroundQueryCacheRefreshTicks(const AZ::u16) = 0;
+        virtual AZ::u32 GetTickGroundCacheHits() const = 0;
+        virtual AZ::u32 GetTickGroundCacheMisses() const = 0;
+        virtual AZ::u32 GetTickBatchedSceneQueryCount() const = 0;
+        virtual bool GetEnableGroundQueryBatch() const = 0;
+        virtual void SetEnableGroundQueryBatch(const bool) = 0;
         virtual void IsAutonomousSoConnect() = 0;
         virtual void NotAutonomousSoDisconnect() = 0;
     };
@@ -6,6 +6,7 @@
 
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/string/string.h>
 
 namespace FirstPersonController
 {
@@ -14,7 +15,14 @@ namespace FirstPersonController
     public:
         AZ_RTTI(NetworkFPCRequests, "{462A6CB2-771A-4C9C-9CBA-336EF989E955}");
         virtual ~NetworkFPCRequests() = default;
-        // Put your public methods here
+
+        // Property and network input statistics, recorded per connection while net_FPCPropertyStatsEnabled is set
+        virtual void RecordNetworkFPCPropertyUpdate(const AZ::u32 connectionId, const AZ::u16 statId, const size_t bytes) = 0;
+        virtual AZ::u64 GetNetworkFPCPropertyUpdateCount(const AZStd::string& name) const = 0;
+        virtual AZ::u64 GetNetworkFPCPropertyBytes(const AZStd::string& name) const = 0;
+        virtual float GetNetworkFPCPropertyUpdateRate(const AZStd::string& name) const = 0;
+        virtual void DumpNetworkFPCPropertyStats() const = 0;
+        virtual void ResetNetworkFPCPropertyStats() = 0;
     };
 
     class NetworkFPCBusTraits : public AZ::EBusTraits
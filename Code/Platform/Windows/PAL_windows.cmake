@@ -1,4 +1,4 @@
 
 set(PAL_TRAIT_FIRSTPERSONCONTROLLER_SUPPORTED TRUE)
-set(PAL_TRAIT_FIRSTPERSONCONTROLLER_TEST_SUPPORTED FALSE)
+set(PAL_TRAIT_FIRSTPERSONCONTROLLER_TEST_SUPPORTED TRUE)
 set(PAL_TRAIT_FIRSTPERSONCONTROLLER_EDITOR_TEST_SUPPORTED FALSE)
@@ -62,14 +62,16 @@ namespace FirstPersonController
 
     void CameraCoupledChildComponent::Activate()
     {
-        AZ::TickBus::Handler::BusConnect();
+        FrameStageConnect(FrameStage::Attachments);
         AZ::EntityBus::Handler::BusConnect(GetEntityId());
+        AZ::TransformNotificationBus::Handler::BusConnect(GetEntityId());
     }
 
     void CameraCoupledChildComponent::Deactivate()
     {
-        AZ::TickBus::Handler::BusDisconnect();
+        FrameStageDisconnect();
         AZ::EntityBus::Handler::BusDisconnect();
+        AZ::TransformNotificationBus::Handler::BusDisconnect();
     }
 
     void CameraCoupledChildComponent::OnEntityActivated([[maybe_unused]] const AZ::EntityId& entityId)
@@ -108,6 +110,15 @@ namespace FirstPersonController
         }
     }
 
+    void CameraCoupledChildComponent::OnParentChanged([[maybe_unused]] AZ::EntityId oldParent, [[maybe_unused]] AZ::EntityId newParent)
+    {
+        // A child without a Network Transform component is only parented to the character after it has
+        // activated, so rebind to the controller of whichever character it now belongs to
+        m_firstPersonControllerObject = nullptr;
+        m_firstPersonExtrasObject = nullptr;
+        ObtainFirstPersonControllerObject();
+    }
+
     AZ::Entity* CameraCoupledChildComponent::GetActiveCamera() const
     {
         AZ::EntityId activeCameraId;
@@ -131,12 +142,7 @@ namespace FirstPersonController
         incompatible.push_back(AZ_CRC_CE("CameraCoupledChildService"));
     }
 
-    int CameraCoupledChildComponent::GetTickOrder()
-    {
-        return AZ::TICK_DEFAULT;
-    }
-
-    void CameraCoupledChildComponent::OnTick(float deltaTime, AZ::ScriptTimePoint)
+    void CameraCoupledChildComponent::OnFrameStage([[maybe_unused]] const FrameStage stage, const float deltaTime)
     {
         ProcessInput(deltaTime);
     }
@@ -168,20 +174,13 @@ namespace FirstPersonController
         const float childZOffset = m_firstPersonControllerObject->m_eyeHeight - m_initialZOffset;
 
         // Set the child's yaw rotation to be the same as the camera
-        AZ::Vector3 zPositiveDirection = AZ::Vector3::CreateAxisZ();
-        if (isCameraChildOfCharacter)
-        {
-            const AZ::Vector3 childRotation = GetEntity()->GetTransform()->GetLocalRotation();
-            GetEntity()->GetTransform()->SetLocalRotation(
-                AZ::Vector3(childRotation.GetX(), childRotation.GetY(), m_firstPersonControllerObject->m_cameraYaw));
-        }
-        else
-        {
-            const AZ::Vector3 childRotation = GetEntity()->GetTransform()->GetWorldRotation();
-            GetEntity()->GetTransform()->SetWorldRotation(
-                AZ::Vector3(childRotation.GetX(), childRotation.GetY(), m_firstPersonControllerObject->m_cameraYaw));
-            zPositiveDirection = m_firstPersonControllerObject->m_sphereCastsAxisDirectionPose;
-        }
+        AZ::TransformInterface* childTransform = GetEntity()->GetTransform();
+        AZ::Transform childTM = isCameraChildOfCharacter ? childTransform->GetLocalTM() : childTransform->GetWorldTM();
+        const AZ::Vector3 childRotation = childTM.GetRotation().GetEulerRadians();
+        childTM.SetRotation(AZ::Quaternion::CreateFromEulerRadiansXYZ(
+            AZ::Vector3(childRotation.GetX(), childRotation.GetY(), m_firstPersonControllerObject->m_cameraYaw)));
+        const AZ::Vector3 zPositiveDirection =
+            isCameraChildOfCharacter ? AZ::Vector3::CreateAxisZ() : m_firstPersonControllerObject->m_sphereCastsAxisDirectionPose;
 
         // Calculate the child entity's new translation, based on whether the character is crouching
         AZ::Vector3 newChildTranslation = AZ::Vector3::CreateZero();
@@ -193,22 +192,24 @@ namespace FirstPersonController
         else
             newChildTranslation = cameraTranslation - childZOffset * zPositiveDirection;
 
-        // Set the new translation
+        // Write the rotation and translation together, and not at all when the child hasn't moved
+        childTM.SetTranslation(newChildTranslation);
         if (isCameraChildOfCharacter)
-            GetEntity()->GetTransform()->SetLocalTranslation(newChildTranslation);
-        else
-            GetEntity()->GetTransform()->SetWorldTranslation(newChildTranslation);
+        {
+            if (!childTM.IsClose(childTransform->GetLocalTM(), 0.f))
+                childTransform->SetLocalTM(childTM);
+        }
+        else if (!childTM.IsClose(childTransform->GetWorldTM(), 0.f))
+            childTransform->SetWorldTM(childTM);
     }
 
     void CameraCoupledChildComponent::ProcessInput([[maybe_unused]] const float deltaTime)
     {
-        bool networkFPCEnabled = true;
-        FirstPersonControllerComponentRequestBus::BroadcastResult(
-            networkFPCEnabled, &FirstPersonControllerComponentRequestBus::Events::GetLocallyEnableNetworkFPC);
-        if (networkFPCEnabled && m_firstPersonControllerObject == nullptr)
-            ObtainFirstPersonControllerObject();
+        // The controller is bound on activation and whenever the child is reparented, and the NetworkFPC
+        // flag is read straight off it, so nothing here goes out over a bus
         if (!m_enable || m_firstPersonControllerObject == nullptr || !m_firstPersonControllerObject->m_cameraSmoothFollow ||
-            (networkFPCEnabled && !m_firstPersonControllerObject->m_isAutonomousClient && !m_firstPersonControllerObject->m_isHost))
+            (m_firstPersonControllerObject->m_networkFPCEnabled && !m_firstPersonControllerObject->m_isAutonomousClient &&
+             !m_firstPersonControllerObject->m_isHost))
             return;
 
         CoupleChildToCamera();
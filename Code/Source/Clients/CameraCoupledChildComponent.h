@@ -9,14 +9,13 @@
 
 #include <Clients/FirstPersonControllerComponent.h>
 #include <Clients/FirstPersonExtrasComponent.h>
+#include <Clients/FrameStageGraph.h>
 
 #include <AzFramework/Components/CameraBus.h>
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/EntityBus.h>
-#include <AzCore/Component/TickBus.h>
-
-#include <AzFramework/Components/CameraBus.h>
+#include <AzCore/Component/TransformBus.h>
 
 namespace FirstPersonController
 {
@@ -24,8 +23,9 @@ namespace FirstPersonController
 
     class CameraCoupledChildComponent
         : public AZ::Component
-        , public AZ::TickBus::Handler
+        , public FrameStageHandler
         , public AZ::EntityBus::Handler
+        , public AZ::TransformNotificationBus::Handler
         , public CameraCoupledChildComponentRequestBus::Handler
     {
         friend class FirstPersonControllerComponent;
@@ -44,6 +44,9 @@ namespace FirstPersonController
         // AZ::EntityBus interface
         void OnEntityActivated(const AZ::EntityId& entityId) override;
 
+        // AZ::TransformNotificationBus interface
+        void OnParentChanged(AZ::EntityId oldParent, AZ::EntityId newParent) override;
+
         static void GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent);
         static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
         static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
@@ -88,8 +91,7 @@ namespace FirstPersonController
         // The active camera entity, used when FirstPersonExtrasComponent isn't present
         AZ::Entity* m_activeCameraEntity = nullptr;
 
-        // TickBus interface
-        void OnTick(float deltaTime, AZ::ScriptTimePoint) override;
-        int GetTickOrder() override;
+        // FrameStageHandler interface
+        void OnFrameStage(const FrameStage stage, const float deltaTime) override;
     };
 } // namespace FirstPersonController
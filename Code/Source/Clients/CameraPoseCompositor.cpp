@@ -0,0 +1,161 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Clients/CameraPoseCompositor.h>
+
+#include <AzCore/Component/TransformBus.h>
+
+namespace FirstPersonController
+{
+    void CameraPoseCompositor::Bind(const AZ::EntityId& cameraEntityId)
+    {
+        if (cameraEntityId == m_cameraEntityId)
+            return;
+
+        Unbind();
+        if (!cameraEntityId.IsValid())
+            return;
+
+        m_cameraEntityId = cameraEntityId;
+        AZ::TransformBus::EventResult(m_baseLocalTM, m_cameraEntityId, &AZ::TransformBus::Events::GetLocalTM);
+        m_writtenLocalTM = m_baseLocalTM;
+        m_synced = true;
+        FrameStageConnect(FrameStage::CameraCompose);
+    }
+
+    void CameraPoseCompositor::Unbind()
+    {
+        if (!m_cameraEntityId.IsValid())
+            return;
+
+        Apply();
+        FrameStageDisconnect();
+        m_cameraEntityId = AZ::EntityId();
+        m_translationOffset = AZ::Vector3::CreateZero();
+        m_rotationOffset = AZ::Quaternion::CreateIdentity();
+    }
+
+    bool CameraPoseCompositor::IsBound() const
+    {
+        return m_cameraEntityId.IsValid();
+    }
+
+    const AZ::EntityId& CameraPoseCompositor::GetCameraEntityId() const
+    {
+        return m_cameraEntityId;
+    }
+
+    void CameraPoseCompositor::SetWorldTranslation(const AZ::Vector3& worldTranslation)
+    {
+        Sync();
+        m_baseLocalTM.SetTranslation(GetParentWorldTM().GetInverse().TransformPoint(worldTranslation));
+    }
+
+    void CameraPoseCompositor::SetLocalTranslation(const AZ::Vector3& localTranslation)
+    {
+        Sync();
+        m_baseLocalTM.SetTranslation(localTranslation);
+    }
+
+    void CameraPoseCompositor::SetLocalZ(const float localZ)
+    {
+        Sync();
+        AZ::Vector3 localTranslation = m_baseLocalTM.GetTranslation();
+        localTranslation.SetZ(localZ);
+        m_baseLocalTM.SetTranslation(localTranslation);
+    }
+
+    void CameraPoseCompositor::SetLocalRotation(const AZ::Quaternion& localRotation)
+    {
+        Sync();
+        m_baseLocalTM.SetRotation(localRotation);
+    }
+
+    void CameraPoseCompositor::SetWorldRotation(const AZ::Quaternion& worldRotation)
+    {
+        Sync();
+        m_baseLocalTM.SetRotation(GetParentWorldTM().GetRotation().GetInverseFull() * worldRotation);
+    }
+
+    AZ::Vector3 CameraPoseCompositor::GetLocalTranslation()
+    {
+        Sync();
+        return m_baseLocalTM.GetTranslation();
+    }
+
+    AZ::Quaternion CameraPoseCompositor::GetLocalRotation()
+    {
+        Sync();
+        return m_baseLocalTM.GetRotation();
+    }
+
+    AZ::Quaternion CameraPoseCompositor::GetWorldRotation()
+    {
+        Sync();
+        return GetParentWorldTM().GetRotation() * m_baseLocalTM.GetRotation();
+    }
+
+    void CameraPoseCompositor::AddTranslationOffset(const AZ::Vector3& translationOffset)
+    {
+        m_translationOffset += translationOffset;
+    }
+
+    void CameraPoseCompositor::AddRotationOffset(const AZ::Quaternion& rotationOffset)
+    {
+        m_rotationOffset = m_rotationOffset * rotationOffset;
+    }
+
+    void CameraPoseCompositor::Apply()
+    {
+        if (!m_cameraEntityId.IsValid())
+            return;
+
+        Sync();
+
+        AZ::Transform composedLocalTM = m_baseLocalTM;
+        composedLocalTM.SetTranslation(m_baseLocalTM.GetTranslation() + m_translationOffset);
+        composedLocalTM.SetRotation((m_baseLocalTM.GetRotation() * m_rotationOffset).GetNormalized());
+
+        m_translationOffset = AZ::Vector3::CreateZero();
+        m_rotationOffset = AZ::Quaternion::CreateIdentity();
+        m_synced = false;
+
+        // An unchanged pose is not written, so a still camera fires no transform notifications
+        if (composedLocalTM.IsClose(m_writtenLocalTM, 0.f))
+            return;
+
+        AZ::TransformBus::Event(m_cameraEntityId, &AZ::TransformBus::Events::SetLocalTM, composedLocalTM);
+        m_writtenLocalTM = composedLocalTM;
+    }
+
+    void CameraPoseCompositor::OnFrameStage([[maybe_unused]] const FrameStage stage, [[maybe_unused]] const float deltaTime)
+    {
+        Apply();
+    }
+
+    void CameraPoseCompositor::Sync()
+    {
+        if (m_synced || !m_cameraEntityId.IsValid())
+            return;
+        m_synced = true;
+
+        AZ::Transform currentLocalTM = AZ::Transform::CreateIdentity();
+        AZ::TransformBus::EventResult(currentLocalTM, m_cameraEntityId, &AZ::TransformBus::Events::GetLocalTM);
+        if (!currentLocalTM.IsClose(m_writtenLocalTM, 0.f))
+        {
+            m_baseLocalTM = currentLocalTM;
+            m_writtenLocalTM = currentLocalTM;
+        }
+    }
+
+    AZ::Transform CameraPoseCompositor::GetParentWorldTM() const
+    {
+        AZ::EntityId parentId;
+        AZ::TransformBus::EventResult(parentId, m_cameraEntityId, &AZ::TransformBus::Events::GetParentId);
+        AZ::Transform parentWorldTM = AZ::Transform::CreateIdentity();
+        if (parentId.IsValid())
+            AZ::TransformBus::EventResult(parentWorldTM, parentId, &AZ::TransformBus::Events::GetWorldTM);
+        return parentWorldTM;
+    }
+} // namespace FirstPersonController
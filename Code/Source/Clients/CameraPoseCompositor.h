@@ -0,0 +1,63 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <Clients/FrameStageGraph.h>
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Transform.h>
+
+namespace FirstPersonController
+{
+    // Collects every contribution to a camera's pose within a frame and writes the result with a single local transform
+    // write, in the camera compose stage, after the First Person Controller and First Person Extras and before anything coupled to it.
+    // The base pose persists between frames and each contributor replaces its part of it, while offsets such as the headbob
+    // are added on top for the current frame only. A pose written to the camera by anything else is taken as the new base.
+    class CameraPoseCompositor : public FrameStageHandler
+    {
+    public:
+        // Binding a different camera writes out what is pending for the previous one and takes the new camera's pose as the base
+        void Bind(const AZ::EntityId& cameraEntityId);
+        void Unbind();
+        bool IsBound() const;
+        const AZ::EntityId& GetCameraEntityId() const;
+
+        // Base pose contributions
+        void SetWorldTranslation(const AZ::Vector3& worldTranslation);
+        void SetLocalTranslation(const AZ::Vector3& localTranslation);
+        void SetLocalZ(const float localZ);
+        void SetLocalRotation(const AZ::Quaternion& localRotation);
+        void SetWorldRotation(const AZ::Quaternion& worldRotation);
+
+        // The base pose, without this frame's offsets
+        AZ::Vector3 GetLocalTranslation();
+        AZ::Quaternion GetLocalRotation();
+        AZ::Quaternion GetWorldRotation();
+
+        // Offsets applied in the camera's local space on top of the base pose for the current frame
+        void AddTranslationOffset(const AZ::Vector3& translationOffset);
+        void AddRotationOffset(const AZ::Quaternion& rotationOffset);
+
+        // Writes the composed pose when it differs from the last one written, then clears the offsets. Also called before the
+        // camera is reparented, so the pose after the change is picked up as the new base.
+        void Apply();
+
+        // FrameStageHandler interface
+        void OnFrameStage(const FrameStage stage, const float deltaTime) override;
+
+    private:
+        // Rebases on the camera's current pose when it was moved by something else since the last write
+        void Sync();
+        AZ::Transform GetParentWorldTM() const;
+
+        AZ::EntityId m_cameraEntityId;
+        AZ::Transform m_baseLocalTM = AZ::Transform::CreateIdentity();
+        AZ::Transform m_writtenLocalTM = AZ::Transform::CreateIdentity();
+        AZ::Vector3 m_translationOffset = AZ::Vector3::CreateZero();
+        AZ::Quaternion m_rotationOffset = AZ::Quaternion::CreateIdentity();
+        bool m_synced = false;
+    };
+} // namespace FirstPersonController
@@ -0,0 +1,383 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Clients/CharacterMotionCore.h>
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/Quaternion.h>
+
+namespace FirstPersonController
+{
+    namespace CharacterMotionCore
+    {
+        AZ::Vector2 CreateEllipseScaledVector(
+            const AZ::Vector2& unscaledVector,
+            const float forwardScale,
+            const float backScale,
+            const float leftScale,
+            const float rightScale)
+        {
+            if (unscaledVector.IsZero())
+                return AZ::Vector2::CreateZero();
+
+            const float x = unscaledVector.GetX();
+            const float y = unscaledVector.GetY();
+            const float length = unscaledVector.GetLength();
+
+            // Select the ellipse radii based on the quadrant
+            const float xScale = (x >= 0.f) ? rightScale : leftScale;
+            const float yScale = (y >= 0.f) ? forwardScale : backScale;
+
+            // Ellipse intersection
+            const float denominatorSquared = (yScale * x) * (yScale * x) + (xScale * y) * (xScale * y);
+
+            // Prevent division by zero if the scales are zero
+            if (denominatorSquared <= 0.f)
+                return AZ::Vector2::CreateZero();
+
+            // Compute the scaling factor
+            const float scale = (xScale * yScale * length) / sqrt(denominatorSquared);
+
+            // Apply the scaling
+            return AZ::Vector2(scale * x, scale * y);
+        }
+
+        AZ::Vector2 LerpVelocityXY(
+            VelocityXYState& state,
+            const VelocityXYParams& params,
+            const QueryResults& queryResults,
+            const AZ::Vector2& targetVelocityXY,
+            const float deltaTime)
+        {
+            state.m_totalLerpTime = state.m_prevApplyVelocityXY.GetDistance(targetVelocityXY) / params.m_accel;
+
+            if (state.m_totalLerpTime == 0.f)
+            {
+                state.m_accelerating = false;
+                state.m_decelerationFactorApplied = false;
+                state.m_opposingDecelFactorApplied = false;
+                return state.m_prevApplyVelocityXY;
+            }
+
+            // Apply the sprint factor to the acceleration (dt) based on the sprint having been (recently) pressed
+            const float lastLerpTime = state.m_lerpTime;
+
+            float lerpDeltaTime = (state.m_sprintAccumulatedAccel > 0.f || state.m_sprintVelocityAdjust != 1.f)
+                ? deltaTime * state.m_sprintAccelAdjust
+                : deltaTime;
+            if (state.m_sprintAccelValue < 1.f && state.m_sprintAccumulatedAccel > 0.f)
+                lerpDeltaTime = deltaTime * state.m_sprintAccelAdjust;
+
+            lerpDeltaTime *= queryResults.m_grounded ? 1.f : params.m_jumpAccelFactor;
+
+            state.m_lerpTime += lerpDeltaTime;
+
+            if (state.m_lerpTime >= state.m_totalLerpTime)
+                state.m_lerpTime = state.m_totalLerpTime;
+
+            // Lerp the velocity from the last applied velocity to the target velocity
+            AZ::Vector2 newVelocityXY = state.m_prevApplyVelocityXY.Lerp(targetVelocityXY, state.m_lerpTime / state.m_totalLerpTime);
+
+            // Decelerate at a different rate than the acceleration
+            if (newVelocityXY.GetLength() < state.m_applyVelocityXY.GetLength())
+            {
+                state.m_accelerating = false;
+                state.m_decelerationFactorApplied = true;
+                // Get the current velocity vector with respect to the character's local coordinate system
+                const AZ::Vector2 applyVelocityHeading = AZ::Vector2(
+                    AZ::Quaternion::CreateRotationZ(-state.m_currentHeading).TransformVector(AZ::Vector3(state.m_applyVelocityXY)));
+
+                // Compare the direction of the current velocity vector against the desired direction
+                // and if it's greater than 90 degrees then decelerate even more
+                if (targetVelocityXY.GetLength() != 0.f && params.m_instantVelocityRotation
+                        ? (abs(applyVelocityHeading.AngleSafe(targetVelocityXY)) > AZ::Constants::HalfPi)
+                        : (abs(state.m_applyVelocityXY.AngleSafe(targetVelocityXY)) > AZ::Constants::HalfPi))
+                {
+                    state.m_opposingDecelFactorApplied = true;
+                    state.m_decelerationFactorApplied = false;
+                    // Compute the deceleration factor based on the magnitude of the target velocity
+                    float greatestScale = params.m_forwardScale;
+                    for (float scale : { params.m_forwardScale, params.m_backScale, params.m_leftScale, params.m_rightScale })
+                        if (greatestScale < abs(scale))
+                            greatestScale = abs(scale);
+
+                    AZ::Vector2 targetVelocityXYLocal = targetVelocityXY;
+                    if (!params.m_instantVelocityRotation)
+                        targetVelocityXYLocal = AZ::Vector2(
+                            AZ::Quaternion::CreateRotationZ(-state.m_currentHeading).TransformVector(AZ::Vector3(targetVelocityXY)));
+
+                    if (state.m_standing || params.m_sprintWhileCrouched)
+                        state.m_decelerationFactor =
+                            (params.m_decel +
+                             (params.m_opposingDecel - params.m_decel) * targetVelocityXYLocal.GetLength() /
+                                 (params.m_speed * (1.f + (state.m_sprintVelocityAdjust - 1.f)) * greatestScale));
+                    else
+                        state.m_decelerationFactor =
+                            (params.m_decel +
+                             (params.m_opposingDecel - params.m_decel) * targetVelocityXYLocal.GetLength() /
+                                 (params.m_speed * params.m_crouchScale * greatestScale));
+                }
+                else
+                {
+                    state.m_decelerationFactor = params.m_decel;
+                    state.m_opposingDecelFactorApplied = false;
+                }
+
+                // Use the deceleration factor to get the lerp time closer to the total lerp time at a faster rate
+                state.m_lerpTime = lastLerpTime + lerpDeltaTime * state.m_decelerationFactor;
+
+                if (state.m_lerpTime >= state.m_totalLerpTime)
+                    state.m_lerpTime = state.m_totalLerpTime;
+
+                AZ::Vector2 newVelocityXYDecel =
+                    state.m_prevApplyVelocityXY.Lerp(targetVelocityXY, state.m_lerpTime / state.m_totalLerpTime);
+                if (newVelocityXYDecel.GetLength() < state.m_applyVelocityXY.GetLength())
+                    newVelocityXY = newVelocityXYDecel;
+            }
+            else
+            {
+                state.m_accelerating = true;
+                state.m_decelerationFactorApplied = false;
+                state.m_opposingDecelFactorApplied = false;
+            }
+
+            if (!AZ::IsClose(state.m_sprintAccelAdjust, 1.f))
+            {
+                if (!AZ::IsClose(state.m_sprintVelocityAdjust, 1.f) || (newVelocityXY.GetLength() < state.m_applyVelocityXY.GetLength()))
+                    state.m_sprintAccumulatedAccel += (newVelocityXY.GetLength() - state.m_applyVelocityXY.GetLength());
+                else
+                    state.m_sprintAccumulatedAccel = 0.f;
+
+                if (state.m_sprintAccumulatedAccel < 0.f)
+                    state.m_sprintAccumulatedAccel = 0.f;
+            }
+            else
+                state.m_sprintAccumulatedAccel = 0.f;
+
+            return newVelocityXY;
+        }
+
+        float JumpMaxHoldTime(
+            const float jumpInitialVelocity, const float heldGravity, const float jumpHoldDistance, bool& apogeeInHoldDistance)
+        {
+            // Calculate the amount of time that the jump key can be held based on the jump hold distance
+            // divided by the average of the initial jump velocity and the velocity at the transition point
+            const float jumpVelocityHoldDistanceSquared = jumpInitialVelocity * jumpInitialVelocity + 2.f * heldGravity * jumpHoldDistance;
+
+            // If the initial velocity is large enough such that the apogee can be reached outside of the jump hold distance
+            // then compute how long the jump key is held while still inside the jump hold distance
+            apogeeInHoldDistance = !(jumpVelocityHoldDistanceSquared >= 0.f);
+            if (!apogeeInHoldDistance)
+                return jumpHoldDistance / ((jumpInitialVelocity + sqrt(jumpVelocityHoldDistanceSquared)) / 2.f);
+
+            // Otherwise the apogee will be reached inside the jump hold distance and the jump time needs to computed accordingly
+            return abs(jumpInitialVelocity / heldGravity);
+        }
+
+        float GravityDeltaZ(const GravityParams& params, const GravityPhase phase, const float deltaTime)
+        {
+            switch (phase)
+            {
+            case GravityPhase::JumpHeld:
+                return params.m_gravity * params.m_jumpHeldGravityFactor * deltaTime;
+            case GravityPhase::Falling:
+                return params.m_gravity * params.m_jumpFallingGravityFactor * deltaTime;
+            default:
+                return params.m_gravity * deltaTime;
+            }
+        }
+
+        bool DecayLinearImpulse(
+            ImpulseState& state,
+            const ImpulseParams& params,
+            const QueryResults& queryResults,
+            const float deltaTime,
+            AZ::Vector2& applyVelocityXY,
+            float& applyVelocityZ)
+        {
+            // Only apply impulses if it's enabled, allow any residual velocity from a previous impulse to decay
+            if (!params.m_enableImpulses)
+            {
+                state.m_linearImpulse = AZ::Vector3::CreateZero();
+                if (state.m_velocityFromImpulse.IsZero())
+                    return false;
+            }
+
+            if (params.m_decelUsesFriction && queryResults.m_groundHit)
+                state.m_constantDecel = -1.f * params.m_gravity * queryResults.m_groundDynamicFriction;
+            else if (!queryResults.m_groundHit)
+                state.m_constantDecel = 0.f;
+
+            // Convert the linear impulse to a velocity based on the character's mass and accumulate it
+            const AZ::Vector3 impulseVelocity = state.m_linearImpulse / params.m_characterMass;
+            state.m_velocityFromImpulse += impulseVelocity;
+
+            // When using a constant deceleration, calculate a new total lerp time when an impulse is applied or when the deceleration
+            // changes
+            if (!impulseVelocity.IsZero() || state.m_prevConstantDecel != state.m_constantDecel)
+            {
+                state.m_initVelocityFromImpulse = state.m_velocityFromImpulse;
+                state.m_totalLerpTime = state.m_initVelocityFromImpulse.GetLength() / state.m_constantDecel;
+                state.m_lerpTime = 0.f;
+                state.m_prevConstantDecel = state.m_constantDecel;
+            }
+
+            // Decelerate using the linear damping value
+            if (params.m_linearDamp != 0.f)
+            {
+                // This follows a first-order homogeneous linear recurrence relation, similar to Stokes' Law
+                state.m_velocityFromImpulse *= (1 - params.m_linearDamp * deltaTime);
+                if (state.m_constantDecel != 0.f)
+                {
+                    state.m_initVelocityFromImpulse = state.m_velocityFromImpulse;
+                    state.m_totalLerpTime = state.m_initVelocityFromImpulse.GetLength() / state.m_constantDecel;
+                    state.m_lerpTime = 0.f;
+                    state.m_prevConstantDecel = state.m_constantDecel;
+                }
+            }
+
+            // Apply the velocity from the impulse
+            applyVelocityXY = AZ::Vector2(state.m_velocityFromImpulse);
+            applyVelocityZ += state.m_velocityFromImpulse.GetZ();
+
+            // Accumulate the deltaTime
+            state.m_lerpTime += deltaTime;
+
+            // Decelerate at a constant rate
+            // If the total lerp time is zero or the lerp time has reached the total lerp time then do not continue adding velocity
+            if (state.m_constantDecel != 0.f && (state.m_totalLerpTime == 0.f || state.m_lerpTime >= state.m_totalLerpTime))
+            {
+                state.m_lerpTime = state.m_totalLerpTime;
+                state.m_initVelocityFromImpulse = AZ::Vector3::CreateZero();
+                state.m_velocityFromImpulse = AZ::Vector3::CreateZero();
+                state.m_linearImpulse = AZ::Vector3::CreateZero();
+                return true;
+            }
+            // Set the applied velocity based on the time that was calculated for it to reach zero
+            else if (state.m_constantDecel != 0.f)
+                state.m_velocityFromImpulse =
+                    state.m_initVelocityFromImpulse.Lerp(AZ::Vector3::CreateZero(), state.m_lerpTime / state.m_totalLerpTime);
+
+            // Set the Z component of the velocity from the impulse to zero after it's applied
+            state.m_velocityFromImpulse.SetZ(0.f);
+
+            // Zero the impulse vector since it's been applied for this update
+            state.m_linearImpulse = AZ::Vector3::CreateZero();
+
+            return true;
+        }
+
+        float GreatestScale(const float initialScale, const float forward, const float back, const float left, const float right)
+        {
+            float greatestScale = initialScale;
+            for (const float scale : { forward, back, left, right })
+                if (abs(scale) > abs(greatestScale))
+                    greatestScale = scale;
+            return greatestScale;
+        }
+
+        float SprintAccelAdjust(const float sprintAccelValue, const float greatestSprintScale, const float velocityAdjust)
+        {
+            if (sprintAccelValue >= 1.f)
+            {
+                if (greatestSprintScale >= 1.f)
+                    return (sprintAccelValue - 1.f) / (greatestSprintScale - 1.f) * (velocityAdjust - 1.f) + 1.f;
+                return (sprintAccelValue - 1.f) / (greatestSprintScale) * (velocityAdjust) + 1.f;
+            }
+
+            if (greatestSprintScale >= 1.f)
+                return (sprintAccelValue) / (greatestSprintScale - 1.f) * (velocityAdjust - 1.f);
+            return (sprintAccelValue) / (greatestSprintScale) * (velocityAdjust);
+        }
+
+        AZ::u8 DrainStamina(
+            StaminaState& state,
+            const StaminaParams& params,
+            const float velocityAdjust,
+            const float greatestSprintScale,
+            const float deltaTime)
+        {
+            AZ::u8 events = StaminaEventNone;
+            state.m_increasing = false;
+
+            if (params.m_usesStamina)
+            {
+                state.m_decreasing = true;
+                state.m_heldDuration += deltaTime * (velocityAdjust - 1.f) / (greatestSprintScale - 1.f);
+            }
+
+            if (state.m_heldDuration >= params.m_maxTime)
+            {
+                state.m_heldDuration = params.m_maxTime;
+                events |= StaminaEventReachedZero;
+            }
+
+            state.m_pause = params.m_pauseTime;
+            return events;
+        }
+
+        AZ::u8 RecoverStamina(StaminaState& state, const StaminaParams& params, const float deltaTime)
+        {
+            AZ::u8 events = StaminaEventNone;
+            state.m_decreasing = false;
+
+            // When the sprint held duration exceeds the maximum sprint time then initiate the cooldown period
+            if (state.m_heldDuration >= params.m_maxTime && state.m_cooldownTimer == 0.f)
+            {
+                state.m_cooldownTimer = params.m_totalCooldownTime;
+                events |= StaminaEventCooldownStarted;
+            }
+
+            state.m_pause -= deltaTime;
+            if (state.m_pause < 0.f)
+                state.m_pause = 0.f;
+
+            if (state.m_pause == 0.f && state.m_cooldownTimer == 0.f && params.m_regenerateAutomatically && state.m_heldDuration > 0.f)
+            {
+                // Decrement the sprint held duration at a rate which makes it so that the stamina
+                // will regenerate when nearly depleted at the same time it would take if you were
+                // just wait through the cooldown time.
+                // Decrement this value by only deltaTime if you wish to instead use the pause
+                // to achieve the same timing but instead through the use of a pause.
+                state.m_heldDuration -=
+                    deltaTime * ((params.m_maxTime + params.m_pauseTime) / params.m_totalCooldownTime) * params.m_regenRate;
+                state.m_increasing = true;
+
+                if (state.m_heldDuration <= 0.f)
+                {
+                    state.m_heldDuration = 0.f;
+                    events |= StaminaEventCapped;
+                }
+            }
+            else
+                state.m_increasing = false;
+
+            if (state.m_cooldownTimer != 0.f)
+            {
+                state.m_cooldownTimer -= deltaTime;
+                if (state.m_cooldownTimer <= 0.f)
+                {
+                    state.m_cooldownTimer = 0.f;
+                    state.m_pause = 0.f;
+                    events |= StaminaEventCooldownDone;
+                    if (params.m_regenerateAutomatically)
+                    {
+                        state.m_heldDuration = 0.f;
+                        state.m_increasing = true;
+                        events |= StaminaEventCapped;
+                    }
+                }
+            }
+
+            return events;
+        }
+
+        float StaminaPercentage(const StaminaState& state, const StaminaParams& params)
+        {
+            if (params.m_maxTime != 0.f)
+                return 100.f * (params.m_maxTime - state.m_heldDuration) / params.m_maxTime;
+            return 0.f;
+        }
+    } // namespace CharacterMotionCore
+} // namespace FirstPersonController
@@ -0,0 +1,181 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/Math/Vector3.h>
+
+namespace FirstPersonController
+{
+    // The movement math of the First Person Controller as pure functions over plain state structs. None of these touch an EBus,
+    // the physics scene or the heap, the component copies its members in and out and raises the notifications itself.
+    namespace CharacterMotionCore
+    {
+        // Results of the scene queries made earlier in the tick which the kernels depend on
+        struct QueryResults
+        {
+            bool m_grounded = true;
+            bool m_groundHit = false;
+            float m_groundDynamicFriction = 0.f;
+        };
+
+        // Scales a vector so that its tip lies on the ellipse described by the four direction scales
+        AZ::Vector2 CreateEllipseScaledVector(
+            const AZ::Vector2& unscaledVector,
+            const float forwardScale,
+            const float backScale,
+            const float leftScale,
+            const float rightScale);
+
+        struct VelocityXYParams
+        {
+            float m_accel = 1.f;
+            float m_decel = 1.f;
+            float m_opposingDecel = 1.f;
+            float m_speed = 1.f;
+            float m_crouchScale = 1.f;
+            float m_jumpAccelFactor = 1.f;
+            float m_forwardScale = 1.f;
+            float m_backScale = 1.f;
+            float m_leftScale = 1.f;
+            float m_rightScale = 1.f;
+            bool m_instantVelocityRotation = true;
+            bool m_sprintWhileCrouched = false;
+        };
+
+        struct VelocityXYState
+        {
+            // Read by the lerp
+            AZ::Vector2 m_prevApplyVelocityXY = AZ::Vector2::CreateZero();
+            AZ::Vector2 m_applyVelocityXY = AZ::Vector2::CreateZero();
+            float m_currentHeading = 0.f;
+            float m_sprintAccelAdjust = 1.f;
+            float m_sprintVelocityAdjust = 1.f;
+            float m_sprintAccelValue = 1.f;
+            bool m_standing = true;
+
+            // Updated by the lerp
+            float m_totalLerpTime = 0.f;
+            float m_lerpTime = 0.f;
+            float m_decelerationFactor = 1.f;
+            float m_sprintAccumulatedAccel = 0.f;
+            bool m_accelerating = false;
+            bool m_decelerationFactorApplied = false;
+            bool m_opposingDecelFactorApplied = false;
+        };
+
+        // Lerps from the previously applied velocity towards the target, decelerating faster than it accelerates and faster still
+        // when the target opposes the current direction. The target is in the character's frame when m_instantVelocityRotation is
+        // set, otherwise it's in the world frame.
+        AZ::Vector2 LerpVelocityXY(
+            VelocityXYState& state,
+            const VelocityXYParams& params,
+            const QueryResults& queryResults,
+            const AZ::Vector2& targetVelocityXY,
+            const float deltaTime);
+
+        // Time the jump key can be held before the jump hold distance is covered. apogeeInHoldDistance is set when the jump peaks
+        // before covering it, in which case the time to the apogee is returned instead.
+        float JumpMaxHoldTime(
+            const float jumpInitialVelocity, const float heldGravity, const float jumpHoldDistance, bool& apogeeInHoldDistance);
+
+        enum class GravityPhase
+        {
+            Free,
+            JumpHeld,
+            Falling
+        };
+
+        struct GravityParams
+        {
+            float m_gravity = -9.81f;
+            float m_jumpHeldGravityFactor = 1.f;
+            float m_jumpFallingGravityFactor = 1.f;
+        };
+
+        // Change in the Z velocity over the time step for the phase of the jump
+        float GravityDeltaZ(const GravityParams& params, const GravityPhase phase, const float deltaTime);
+
+        struct ImpulseParams
+        {
+            float m_characterMass = 1.f;
+            float m_gravity = -9.81f;
+            float m_linearDamp = 0.f;
+            bool m_enableImpulses = true;
+            bool m_decelUsesFriction = true;
+        };
+
+        struct ImpulseState
+        {
+            AZ::Vector3 m_linearImpulse = AZ::Vector3::CreateZero();
+            AZ::Vector3 m_velocityFromImpulse = AZ::Vector3::CreateZero();
+            AZ::Vector3 m_initVelocityFromImpulse = AZ::Vector3::CreateZero();
+            float m_constantDecel = 0.f;
+            float m_prevConstantDecel = 0.f;
+            float m_totalLerpTime = 0.f;
+            float m_lerpTime = 0.f;
+        };
+
+        // Converts the pending impulse to a velocity and decays the velocity from impulses by the linear damping and the constant
+        // deceleration. Returns false without touching the applied velocities when there is nothing to apply, otherwise writes the
+        // XY velocity and adds the Z velocity.
+        bool DecayLinearImpulse(
+            ImpulseState& state,
+            const ImpulseParams& params,
+            const QueryResults& queryResults,
+            const float deltaTime,
+            AZ::Vector2& applyVelocityXY,
+            float& applyVelocityZ);
+
+        // Scale with the greatest magnitude, keeping its sign, or the initial value when none is greater in magnitude
+        float GreatestScale(const float initialScale, const float forward, const float back, const float left, const float right);
+
+        // Acceleration adjustment for sprinting at velocityAdjust, relative to the greatest sprint scale
+        float SprintAccelAdjust(const float sprintAccelValue, const float greatestSprintScale, const float velocityAdjust);
+
+        struct StaminaParams
+        {
+            float m_maxTime = 3.f;
+            float m_pauseTime = 0.f;
+            float m_totalCooldownTime = 5.f;
+            float m_regenRate = 1.f;
+            bool m_usesStamina = true;
+            bool m_regenerateAutomatically = true;
+        };
+
+        struct StaminaState
+        {
+            float m_heldDuration = 0.f;
+            float m_pause = 0.f;
+            float m_cooldownTimer = 0.f;
+            bool m_increasing = false;
+            bool m_decreasing = false;
+        };
+
+        // Bits returned by the stamina updates, raised by the component in this order
+        enum StaminaEvents : AZ::u8
+        {
+            StaminaEventNone = 0,
+            StaminaEventReachedZero = 1 << 0,
+            StaminaEventCooldownStarted = 1 << 1,
+            StaminaEventCooldownDone = 1 << 2,
+            StaminaEventCapped = 1 << 3
+        };
+
+        // Spends stamina while the sprint is applied at velocityAdjust
+        AZ::u8 DrainStamina(
+            StaminaState& state,
+            const StaminaParams& params,
+            const float velocityAdjust,
+            const float greatestSprintScale,
+            const float deltaTime);
+
+        // Starts the cooldown once the stamina is spent, then runs the pause, regeneration and cooldown timers
+        AZ::u8 RecoverStamina(StaminaState& state, const StaminaParams& params, const float deltaTime);
+
+        float StaminaPercentage(const StaminaState& state, const StaminaParams& params);
+    } // namespace CharacterMotionCore
+} // namespace FirstPersonController
@@ -0,0 +1,217 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Clients/FirstPersonControllerBenchmark.h>
+
+#include <Clients/FirstPersonControllerStats.h>
+
+#include <FirstPersonController/FirstPersonControllerBus.h>
+#include <FirstPersonController/FirstPersonControllerComponentBus.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/string/conversions.h>
+
+#include <math.h>
+
+namespace FirstPersonController
+{
+    static void fpc_Benchmark(const AZ::ConsoleCommandContainer& arguments)
+    {
+        FirstPersonControllerRequests* firstPersonController = FirstPersonControllerInterface::Get();
+        if (firstPersonController == nullptr)
+            return;
+
+        AZ::u32 frames = 600;
+        if (!arguments.empty())
+        {
+            // Up to 9 digits always fits in an AZ::u32, and stoul is never handed anything it can't convert
+            const AZStd::string_view framesArgument = arguments[0];
+            const bool digits = !framesArgument.empty() && framesArgument.size() <= 9 &&
+                AZStd::all_of(framesArgument.begin(), framesArgument.end(), [](const char c) { return c >= '0' && c <= '9'; });
+            frames = digits ? static_cast<AZ::u32>(AZStd::stoul(AZStd::string(framesArgument))) : 0;
+            if (frames == 0)
+            {
+                AZ_Warning("FirstPersonControllerBenchmark", false, "The frame count must be a whole number from 1 to 999999999.");
+                return;
+            }
+        }
+        const AZStd::string outputPath =
+            arguments.size() > 1 ? AZStd::string(arguments[1]) : AZStd::string("@user@/FirstPersonControllerBenchmark.json");
+        firstPersonController->StartBenchmark(frames, outputPath);
+    }
+    AZ_CONSOLEFREEFUNC(
+        fpc_Benchmark,
+        AZ::ConsoleFunctorFlags::Null,
+        "Measures the First Person Controller stages over <frames> frames (default 600) and writes the per-stage and per-frame "
+        "timings and scene query counts as JSON to [path] (default @user@/FirstPersonControllerBenchmark.json)");
+
+    namespace
+    {
+        constexpr float HistogramMinValue = 0.0001f;
+        constexpr float HistogramBucketRatio = 1.01f;
+        constexpr size_t HistogramBucketCount = 2048;
+    } // namespace
+
+    void FirstPersonControllerBenchmark::Distribution::Reset()
+    {
+        m_buckets.assign(HistogramBucketCount, 0);
+        m_count = 0;
+        m_sum = 0.0;
+        m_max = 0.f;
+    }
+
+    void FirstPersonControllerBenchmark::Distribution::Add(const float value)
+    {
+        if (m_buckets.empty())
+            m_buckets.resize(HistogramBucketCount, 0);
+
+        const float bucket = value > HistogramMinValue ? logf(value / HistogramMinValue) / logf(HistogramBucketRatio) + 1.f : 0.f;
+        ++m_buckets[AZ::GetMin(static_cast<size_t>(bucket), HistogramBucketCount - 1)];
+        ++m_count;
+        m_sum += value;
+        m_max = AZ::GetMax(m_max, value);
+    }
+
+    AZ::u64 FirstPersonControllerBenchmark::Distribution::GetCount() const
+    {
+        return m_count;
+    }
+
+    float FirstPersonControllerBenchmark::Distribution::GetMean() const
+    {
+        return m_count > 0 ? static_cast<float>(m_sum / m_count) : 0.f;
+    }
+
+    float FirstPersonControllerBenchmark::Distribution::GetMax() const
+    {
+        return m_max;
+    }
+
+    float FirstPersonControllerBenchmark::Distribution::GetPercentile(const float percentile) const
+    {
+        if (m_count == 0)
+            return 0.f;
+
+        const AZ::u64 target = static_cast<AZ::u64>(ceilf(percentile * static_cast<float>(m_count)));
+        AZ::u64 cumulative = 0;
+        for (size_t i = 0; i < m_buckets.size(); ++i)
+        {
+            cumulative += m_buckets[i];
+            if (cumulative >= target)
+                return AZ::GetMin(HistogramMinValue * powf(HistogramBucketRatio, static_cast<float>(i)), m_max);
+        }
+        return m_max;
+    }
+
+    AZStd::string FirstPersonControllerBenchmark::Distribution::ToJson() const
+    {
+        return AZStd::string::format(
+            "{ \"count\": %llu, \"mean\": %.6f, \"p50\": %.6f, \"p99\": %.6f, \"max\": %.6f }",
+            static_cast<unsigned long long>(m_count),
+            GetMean(),
+            GetPercentile(0.5f),
+            GetPercentile(0.99f),
+            m_max);
+    }
+
+    void FirstPersonControllerBenchmark::Start(const AZ::u32 frames, const AZStd::string& outputPath)
+    {
+        m_remainingFrames = frames;
+        m_frames = frames;
+        m_outputPath = outputPath;
+        m_stageDepth = 0;
+        m_frameMilliseconds = 0.f;
+        m_frameSceneQueries = 0;
+        m_characterCount = 0;
+        // The histograms are allocated up front so that nothing allocates while the frames are measured
+        m_frameDistribution.Reset();
+        m_sceneQueryDistribution.Reset();
+        for (Distribution& distribution : m_stageDistributions)
+            distribution.Reset();
+        AZ_Printf("FirstPersonControllerBenchmark", "Measuring %u frames.", frames);
+    }
+
+    bool FirstPersonControllerBenchmark::IsRunning() const
+    {
+        return m_remainingFrames > 0;
+    }
+
+    void FirstPersonControllerBenchmark::BeginStage()
+    {
+        ++m_stageDepth;
+    }
+
+    void FirstPersonControllerBenchmark::EndStage(const BenchmarkStage stage, const float milliseconds)
+    {
+        if (m_stageDepth > 0)
+            --m_stageDepth;
+        if (m_stageDepth == 0)
+            m_frameMilliseconds += milliseconds;
+        m_stageDistributions[static_cast<size_t>(stage)].Add(milliseconds);
+    }
+
+    void FirstPersonControllerBenchmark::RecordSceneQueries(const AZ::u32 sceneQueries)
+    {
+        m_frameSceneQueries += sceneQueries;
+    }
+
+    void FirstPersonControllerBenchmark::OnFrame()
+    {
+        if (!IsRunning())
+            return;
+
+        m_frameDistribution.Add(m_frameMilliseconds);
+        m_sceneQueryDistribution.Add(static_cast<float>(m_frameSceneQueries));
+        m_characterCount = AZ::GetMax(
+            m_characterCount, static_cast<AZ::u32>(FirstPersonControllerComponentRequestBus::GetTotalNumOfEventHandlers()));
+        m_frameMilliseconds = 0.f;
+        m_frameSceneQueries = 0;
+        m_stageDepth = 0;
+
+        if (--m_remainingFrames == 0)
+            WriteReport();
+    }
+
+    void FirstPersonControllerBenchmark::WriteReport() const
+    {
+        AZStd::string report = AZStd::string::format(
+            "{\n  \"frames\": %u,\n  \"characters\": %u,\n  \"frameMilliseconds\": %s,\n  \"sceneQueriesPerFrame\": %s,\n  \"stages\": {",
+            m_frames,
+            m_characterCount,
+            m_frameDistribution.ToJson().c_str(),
+            m_sceneQueryDistribution.ToJson().c_str());
+        bool first = true;
+        for (size_t stage = 0; stage < m_stageDistributions.size(); ++stage)
+        {
+            const Distribution& distribution = m_stageDistributions[stage];
+            if (distribution.GetCount() == 0)
+                continue;
+            report += AZStd::string::format(
+                "%s\n    \"%s\": %s", first ? "" : ",", BenchmarkStageNames[stage], distribution.ToJson().c_str());
+            first = false;
+        }
+        report += "\n  }\n}\n";
+
+        AZ_Printf(
+            "FirstPersonControllerBenchmark",
+            "%u characters, %.4f ms per frame (p50 %.4f, p99 %.4f), %.1f scene queries per frame",
+            m_characterCount,
+            m_frameDistribution.GetMean(),
+            m_frameDistribution.GetPercentile(0.5f),
+            m_frameDistribution.GetPercentile(0.99f),
+            m_sceneQueryDistribution.GetMean());
+
+        AZ::IO::FileIOStream stream(m_outputPath.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeText);
+        if (!stream.IsOpen())
+        {
+            AZ_Warning("FirstPersonControllerBenchmark", false, "Unable to write the benchmark report to %s.", m_outputPath.c_str());
+            return;
+        }
+        stream.Write(report.size(), report.data());
+        AZ_Printf("FirstPersonControllerBenchmark", "Report written to %s.", m_outputPath.c_str());
+    }
+} // namespace FirstPersonController
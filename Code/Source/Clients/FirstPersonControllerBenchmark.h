@@ -0,0 +1,67 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <FirstPersonController/FirstPersonControllerBus.h>
+
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace FirstPersonController
+{
+    // Measures the controllers' cost over a number of frames and writes the results as JSON, see fpc_Benchmark
+    class FirstPersonControllerBenchmark
+    {
+    public:
+        void Start(const AZ::u32 frames, const AZStd::string& outputPath);
+        bool IsRunning() const;
+
+        // Stages may nest, only the outermost stages are added to the frame's total
+        void BeginStage();
+        void EndStage(const BenchmarkStage stage, const float milliseconds);
+        void RecordSceneQueries(const AZ::u32 sceneQueries);
+
+        // Closes the current frame, writing the report once the requested number of frames have been measured
+        void OnFrame();
+
+    private:
+        // Durations are kept in a logarithmic histogram with 1% wide buckets, so percentiles are within 1% regardless of how
+        // many characters and frames are measured
+        class Distribution
+        {
+        public:
+            void Reset();
+            void Add(const float value);
+            AZ::u64 GetCount() const;
+            float GetMean() const;
+            float GetMax() const;
+            float GetPercentile(const float percentile) const;
+            AZStd::string ToJson() const;
+
+        private:
+            AZStd::vector<AZ::u32> m_buckets;
+            AZ::u64 m_count = 0;
+            double m_sum = 0.0;
+            float m_max = 0.f;
+        };
+
+        void WriteReport() const;
+
+        AZ::u32 m_remainingFrames = 0;
+        AZ::u32 m_frames = 0;
+        AZStd::string m_outputPath;
+
+        AZ::u32 m_stageDepth = 0;
+        float m_frameMilliseconds = 0.f;
+        AZ::u32 m_frameSceneQueries = 0;
+        AZ::u32 m_characterCount = 0;
+
+        Distribution m_frameDistribution;
+        Distribution m_sceneQueryDistribution;
+        // Indexed by BenchmarkStage, so recording a stage doesn't allocate
+        AZStd::array<Distribution, static_cast<size_t>(BenchmarkStage::Count)> m_stageDistributions;
+    };
+} // namespace FirstPersonController
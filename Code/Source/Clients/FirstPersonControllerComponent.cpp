@@ -11,14 +11,21 @@
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Serialization/EditContext.h>
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/sort.h>
 
 #include <AzFramework/Input/Devices/Gamepad/InputDeviceGamepad.h>
 #include <AzFramework/Input/Devices/InputDeviceId.h>
+#include <AzFramework/Input/Devices/Mouse/InputDeviceMouse.h>
 #include <AzFramework/Physics/CollisionBus.h>
 #include <AzFramework/Physics/Components/SimulatedBodyComponentBus.h>
 #include <AzFramework/Physics/NameConstants.h>
 #include <AzFramework/Physics/RigidBodyBus.h>
+#include <AzFramework/Physics/SimulatedBodies/StaticRigidBody.h>
 #include <AzFramework/Physics/SystemBus.h>
 
 #include <Atom/RPI.Public/ViewportContext.h>
@@ -32,6 +39,84 @@ namespace FirstPersonController
 {
     using namespace StartingPointInput;
 
+    AZ_DEFINE_BUDGET(FirstPersonController);
+
+    // Starts recording or replaying the inputs of every First Person Controller character, one trace file per character. A replay
+    // may instead be given a single .fpcinput file which every character replays
+    static void StartInputTraces(const AZ::ConsoleCommandContainer& arguments, const bool replay)
+    {
+        if (arguments.empty())
+        {
+            AZ_Warning("First Person Controller Component", false, "An input trace directory is required.");
+            return;
+        }
+        const AZStd::string directory(arguments.front());
+        static constexpr AZStd::string_view TraceExtension = ".fpcinput";
+        const bool sharedTrace = replay && directory.ends_with(TraceExtension);
+
+        AZ::EBusAggregateResults<AZ::EntityId> characterEntityIds;
+        FirstPersonControllerComponentRequestBus::BroadcastResult(
+            characterEntityIds, &FirstPersonControllerComponentRequestBus::Events::GetCharacterEntityId);
+        AZStd::sort(characterEntityIds.values.begin(), characterEntityIds.values.end());
+
+        // Runtime EntityIds change between runs, so traces are keyed by the character's name and its NetEntityId when it has one.
+        // Characters that share a name without a NetEntityId are numbered in EntityId order
+        AZStd::unordered_map<AZStd::string, AZ::u32> nameCounts;
+        for (const AZ::EntityId& characterEntityId : characterEntityIds.values)
+        {
+            const AZ::Entity* characterEntity = AZ::Interface<AZ::ComponentApplicationRequests>::Get()->FindEntity(characterEntityId);
+            if (characterEntity == nullptr)
+                continue;
+            AZ::u64 key = nameCounts[characterEntity->GetName()]++;
+#ifdef NETWORKFPC
+            const Multiplayer::NetEntityId netEntityId =
+                Multiplayer::GetMultiplayer()->GetNetworkEntityManager()->GetNetEntityIdById(characterEntityId);
+            if (netEntityId != Multiplayer::InvalidNetEntityId)
+                key = static_cast<AZ::u64>(netEntityId);
+#endif
+            AZStd::string path = directory;
+            if (!sharedTrace)
+            {
+                path = AZStd::string::format(
+                    "%s/%s_%llu.fpcinput", directory.c_str(), characterEntity->GetName().c_str(), static_cast<unsigned long long>(key));
+                // Characters without a trace of their own, such as spawned copies, replay the trace shared by their name
+                if (replay && !AZ::IO::SystemFile::Exists(path.c_str()))
+                    path = AZStd::string::format("%s/%s.fpcinput", directory.c_str(), characterEntity->GetName().c_str());
+            }
+            if (replay)
+                FirstPersonControllerComponentRequestBus::Event(
+                    characterEntityId, &FirstPersonControllerComponentRequestBus::Events::StartInputReplay, path);
+            else
+                FirstPersonControllerComponentRequestBus::Event(
+                    characterEntityId, &FirstPersonControllerComponentRequestBus::Events::StartInputRecording, path);
+        }
+    }
+
+    static void fpc_InputRecord(const AZ::ConsoleCommandContainer& arguments)
+    {
+        StartInputTraces(arguments, false);
+    }
+    AZ_CONSOLEFREEFUNC(
+        fpc_InputRecord,
+        AZ::ConsoleFunctorFlags::Null,
+        "Records the per-tick inputs and delta time of every First Person Controller character to <directory>/<name>_<key>.fpcinput");
+
+    static void fpc_InputReplay(const AZ::ConsoleCommandContainer& arguments)
+    {
+        StartInputTraces(arguments, true);
+    }
+    AZ_CONSOLEFREEFUNC(
+        fpc_InputReplay,
+        AZ::ConsoleFunctorFlags::Null,
+        "Replays the inputs recorded with fpc_InputRecord from the given directory, or one .fpcinput file for every character, in place "
+        "of the live inputs");
+
+    static void fpc_InputTraceStop([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        FirstPersonControllerComponentRequestBus::Broadcast(&FirstPersonControllerComponentRequestBus::Events::StopInputTrace);
+    }
+    AZ_CONSOLEFREEFUNC(fpc_InputTraceStop, AZ::ConsoleFunctorFlags::Null, "Stops every First Person Controller input recording and replay");
+
     void FirstPersonControllerComponent::Reflect(AZ::ReflectContext* rc)
     {
         if (auto sc = azrtti_cast<AZ::SerializeContext*>(rc))
@@ -55,6 +140,8 @@ namespace FirstPersonController
                 ->Field("Yaw Sensitivity", &FirstPersonControllerComponent::m_yawSensitivity)
                 ->Field("Pitch Sensitivity", &FirstPersonControllerComponent::m_pitchSensitivity)
                 ->Field("Camera Rotation Damp Factor", &FirstPersonControllerComponent::m_rotationDamp)
+                ->Field("Raw Mouse Look", &FirstPersonControllerComponent::m_rawMouseLook)
+                ->Field("Raw Mouse Look Sub-Frame Interpolation", &FirstPersonControllerComponent::m_rawMouseLookSubFrameInterpolation)
 
                 // Direction Scale Factors group
                 ->Field("Forward Scale", &FirstPersonControllerComponent::m_forwardScale)
@@ -196,6 +283,22 @@ namespace FirstPersonController
                 ->Attribute(AZ::Edit::Attributes::Min, -100.f)
                 ->Attribute(AZ::Edit::Attributes::Suffix, " %")
                 ->Field("Hit Detection Group", &FirstPersonControllerComponent::m_characterHitCollisionGroupId)
+                ->Field("Hit Detection Adaptive", &FirstPersonControllerComponent::m_characterHitsAdaptive)
+                ->Field("Hit Detection Idle Sweep Interval", &FirstPersonControllerComponent::m_characterHitsIdleSweepInterval)
+                ->Attribute(AZ::Edit::Attributes::Min, 1)
+
+                // Idle Sleep group
+                ->Field("Idle Sleep", &FirstPersonControllerComponent::m_enableIdleSleep)
+                ->Field("Idle Sleep Quiet Ticks", &FirstPersonControllerComponent::m_idleSleepQuietTicks)
+                ->Attribute(AZ::Edit::Attributes::Min, 1)
+
+                // Ground Query Cache group
+                ->Field("Ground Query Cache", &FirstPersonControllerComponent::m_enableGroundQueryCache)
+                ->Field("Ground Query Cache Move Fraction", &FirstPersonControllerComponent::m_groundQueryCacheMoveFraction)
+                ->Attribute(AZ::Edit::Attributes::Min, 0.f)
+                ->Field("Ground Query Cache Refresh Ticks", &FirstPersonControllerComponent::m_groundQueryCacheRefreshTicks)
+                ->Attribute(AZ::Edit::Attributes::Min, 1)
+                ->Field("Ground Query Batch", &FirstPersonControllerComponent::m_enableGroundQueryBatch)
                 ->Version(1);
 
             if (AZ::EditContext* ec = sc->GetEditContext())
@@ -288,6 +391,18 @@ namespace FirstPersonController
                         "Camera Rotation Damp Factor",
                         "The 'smoothness' of the camera rotation. Applies a damp factor to the camera rotation. Setting this to anything "
                         "greater than or equal to 100 will disable this effect.")
+                    ->DataElement(
+                        nullptr,
+                        &FirstPersonControllerComponent::m_rawMouseLook,
+                        "Raw Mouse Look",
+                        "Rotate the camera from every raw mouse movement event received between ticks rather than the Yaw and Pitch input "
+                        "events, which are then ignored. The sensitivities are applied to the raw mouse deltas directly.")
+                    ->DataElement(
+                        nullptr,
+                        &FirstPersonControllerComponent::m_rawMouseLookSubFrameInterpolation,
+                        "Raw Mouse Look Sub-Frame Interpolation",
+                        "With NetworkFPC, split the raw mouse movement at each network tick's time by the event timestamps, so ticks "
+                        "processed together in one frame each receive their own share of the movement.")
 
                     ->ClassElement(AZ::Edit::ClassElements::Group, "X&Y Movement")
                     ->Attribute(AZ::Edit::Attributes::AutoExpand, false)
@@ -581,7 +696,7 @@ namespace FirstPersonController
                         &FirstPersonControllerComponent::m_jumpHeadSphereCastOffset,
                         "Jump Head Hit Detection Distance",
                         "The distance above the character's head where an obstruction will be detected for jumping. The apogee of the jump "
-                        "occurs when there is a collision.")
+                        "occurs when there is a collision. The check only runs while the character is ascending or may jump.")
                     ->DataElement(
                         nullptr,
                         &FirstPersonControllerComponent::m_headHitSetsApogee,
@@ -707,7 +822,65 @@ namespace FirstPersonController
                         &FirstPersonControllerComponent::m_characterHitCollisionGroupId,
                         "Hit Detection Group",
                         "Collision group that will be detected by the capsule shapecast.")
-                    ->Attribute(AZ::Edit::Attributes::Visibility, &FirstPersonControllerComponent::GetEnableCharacterHits);
+                    ->Attribute(AZ::Edit::Attributes::Visibility, &FirstPersonControllerComponent::GetEnableCharacterHits)
+                    ->DataElement(
+                        nullptr,
+                        &FirstPersonControllerComponent::m_characterHitsAdaptive,
+                        "Adaptive Hit Detection",
+                        "While the character stays put and its last hits are all on static bodies, keeps and notifies those hits and "
+                        "runs the capsule shapecast only once every Idle Sweep Interval ticks. Before each shapecast, the box bounding it "
+                        "is checked for anything besides the kept hits that it could hit, and the shapecast is skipped when there is "
+                        "nothing. Hits on dynamic or removed bodies are swept for every tick.")
+                    ->Attribute(AZ::Edit::Attributes::Visibility, &FirstPersonControllerComponent::GetEnableCharacterHits)
+                    ->DataElement(
+                        nullptr,
+                        &FirstPersonControllerComponent::m_characterHitsIdleSweepInterval,
+                        "Idle Sweep Interval",
+                        "Number of ticks between capsule shapecasts while the character isn't moving, when Adaptive Hit Detection is on.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 1)
+                    ->Attribute(AZ::Edit::Attributes::Visibility, &FirstPersonControllerComponent::GetEnableCharacterHits)
+
+                    ->GroupElementToggle("Idle Sleep", &FirstPersonControllerComponent::m_enableIdleSleep)
+                    ->Attribute(AZ::Edit::Attributes::AutoExpand, false)
+                    ->Attribute(AZ::Edit::Attributes::ChangeNotify, AZ::Edit::PropertyRefreshLevels::AttributesAndValues)
+                    ->DataElement(
+                        nullptr,
+                        &FirstPersonControllerComponent::m_idleSleepQuietTicks,
+                        "Quiet Ticks Before Sleep",
+                        "Number of consecutive ticks the character must stand still on static ground, with no input, impulse or added "
+                        "velocity, before it stops running its ground checks, hit detection and velocity updates. It wakes on the next "
+                        "input, impulse, script change, movement of the ground beneath it, or contact with a rigid body or trigger. Hit "
+                        "detection notifications are not sent while asleep.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 1)
+                    ->Attribute(AZ::Edit::Attributes::Visibility, &FirstPersonControllerComponent::GetEnableIdleSleep)
+
+                    ->GroupElementToggle("Ground Query Cache", &FirstPersonControllerComponent::m_enableGroundQueryCache)
+                    ->Attribute(AZ::Edit::Attributes::AutoExpand, false)
+                    ->Attribute(AZ::Edit::Attributes::ChangeNotify, AZ::Edit::PropertyRefreshLevels::AttributesAndValues)
+                    ->DataElement(
+                        nullptr,
+                        &FirstPersonControllerComponent::m_groundQueryCacheMoveFraction,
+                        "Move Fraction Of Capsule Radius",
+                        "The ground sphere casts reuse the previous tick's hits while every one of them was on a static body and the "
+                        "character has moved less than this fraction of its capsule radius since they were cast, without moving along "
+                        "the cast axis. Set to zero to always cast.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.f)
+                    ->Attribute(AZ::Edit::Attributes::Visibility, &FirstPersonControllerComponent::GetEnableGroundQueryCache)
+                    ->DataElement(
+                        nullptr,
+                        &FirstPersonControllerComponent::m_groundQueryCacheRefreshTicks,
+                        "Refresh Ticks",
+                        "Number of ticks a cached ground result may be reused before the ground is cast again regardless.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 1)
+                    ->Attribute(AZ::Edit::Attributes::Visibility, &FirstPersonControllerComponent::GetEnableGroundQueryCache)
+                    ->DataElement(
+                        nullptr,
+                        &FirstPersonControllerComponent::m_enableGroundQueryBatch,
+                        "Batch Ground Queries",
+                        "The character's ground sphere casts are queued before the controllers run on each frame, physics timestep or, "
+                        "on the autonomous client, network tick, and made together with every other character's in a single batched "
+                        "scene query. A batched result is only used if the character hasn't moved before it checks the ground, "
+                        "otherwise it casts again. Network ticks aren't batched on the server, where each character moves in turn.");
             }
         }
 
@@ -928,6 +1101,12 @@ namespace FirstPersonController
                 ->Event("Set Character Hit By", &FirstPersonControllerComponentRequests::SetCharacterHitBy)
                 ->Event("Get Character Hit EntityIds", &FirstPersonControllerComponentRequests::GetCharacterHitEntityIds)
                 ->Event("Get Character Scene Query Hits", &FirstPersonControllerComponentRequests::GetCharacterSceneQueryHits)
+                ->Event("Get Character Hits Adaptive", &FirstPersonControllerComponentRequests::GetCharacterHitsAdaptive)
+                ->Event("Set Character Hits Adaptive", &FirstPersonControllerComponentRequests::SetCharacterHitsAdaptive)
+                ->Event(
+                    "Get Character Hits Idle Sweep Interval", &FirstPersonControllerComponentRequests::GetCharacterHitsIdleSweepInterval)
+                ->Event(
+                    "Set Character Hits Idle Sweep Interval", &FirstPersonControllerComponentRequests::SetCharacterHitsIdleSweepInterval)
                 ->Event("Get Initial Jump Velocity", &FirstPersonControllerComponentRequests::GetJumpInitialVelocity)
                 ->Event("Set Initial Jump Velocity", &FirstPersonControllerComponentRequests::SetJumpInitialVelocity)
                 ->Event("Get Second Jump Initial Velocity", &FirstPersonControllerComponentRequests::GetJumpSecondInitialVelocity)
@@ -1170,6 +1349,16 @@ namespace FirstPersonController
                 ->Event("Set Camera Pitch Min Angle Degrees", &FirstPersonControllerComponentRequests::SetCameraPitchMinAngleDegrees)
                 ->Event("Get Camera Rotation Damp Factor", &FirstPersonControllerComponentRequests::GetCameraRotationDampFactor)
                 ->Event("Set Camera Rotation Damp Factor", &FirstPersonControllerComponentRequests::SetCameraRotationDampFactor)
+                ->Event("Get Raw Mouse Look", &FirstPersonControllerComponentRequests::GetRawMouseLook)
+                ->Event("Set Raw Mouse Look", &FirstPersonControllerComponentRequests::SetRawMouseLook)
+                ->Event(
+                    "Get Raw Mouse Look Sub-Frame Interpolation",
+                    &FirstPersonControllerComponentRequests::GetRawMouseLookSubFrameInterpolation)
+                ->Event(
+                    "Set Raw Mouse Look Sub-Frame Interpolation",
+                    &FirstPersonControllerComponentRequests::SetRawMouseLookSubFrameInterpolation)
+                ->Event("Get Input To Camera Latency", &FirstPersonControllerComponentRequests::GetInputToCameraLatency)
+                ->Event("Get Input To Camera Latency Max", &FirstPersonControllerComponentRequests::GetInputToCameraLatencyMax)
                 ->Event(
                     "Get Character Transform Interface Pointer", &FirstPersonControllerComponentRequests::GetCharacterTransformInterfacePtr)
                 ->Event("Get Character Transform", &FirstPersonControllerComponentRequests::GetCharacterTransform)
@@ -1209,6 +1398,33 @@ namespace FirstPersonController
                 ->Event("Set Locally Enable NetworkFPC", &FirstPersonControllerComponentRequests::SetLocallyEnableNetworkFPC)
                 ->Event("Get Is Networking Active", &FirstPersonControllerComponentRequests::GetIsNetworkingActive)
                 ->Event("Ignore Inputs", &FirstPersonControllerComponentRequests::IgnoreInputs)
+                ->Event("Start Input Recording", &FirstPersonControllerComponentRequests::StartInputRecording)
+                ->Event("Start Input Replay", &FirstPersonControllerComponentRequests::StartInputReplay)
+                ->Event("Stop Input Trace", &FirstPersonControllerComponentRequests::StopInputTrace)
+                ->Event("Get Input Recording", &FirstPersonControllerComponentRequests::GetInputRecording)
+                ->Event("Get Input Replaying", &FirstPersonControllerComponentRequests::GetInputReplaying)
+                ->Event("Get Tick Scene Query Count", &FirstPersonControllerComponentRequests::GetTickSceneQueryCount)
+                ->Event("Get Tick Hits Processed Count", &FirstPersonControllerComponentRequests::GetTickHitsProcessedCount)
+                ->Event("Get Tick Hits Discarded Count", &FirstPersonControllerComponentRequests::GetTickHitsDiscardedCount)
+                ->Event("Get Tick Bus Event Count", &FirstPersonControllerComponentRequests::GetTickBusEventCount)
+                ->Event("Get Tick Allocated Bytes", &FirstPersonControllerComponentRequests::GetTickAllocatedBytes)
+                ->Event("Get Enable Idle Sleep", &FirstPersonControllerComponentRequests::GetEnableIdleSleep)
+                ->Event("Set Enable Idle Sleep", &FirstPersonControllerComponentRequests::SetEnableIdleSleep)
+                ->Event("Get Idle Sleep Quiet Ticks", &FirstPersonControllerComponentRequests::GetIdleSleepQuietTicks)
+                ->Event("Set Idle Sleep Quiet Ticks", &FirstPersonControllerComponentRequests::SetIdleSleepQuietTicks)
+                ->Event("Get Idle Sleeping", &FirstPersonControllerComponentRequests::GetIdleSleeping)
+                ->Event("Wake From Idle Sleep", &FirstPersonControllerComponentRequests::WakeFromIdleSleep)
+                ->Event("Get Enable Ground Query Cache", &FirstPersonControllerComponentRequests::GetEnableGroundQueryCache)
+                ->Event("Set Enable Ground Query Cache", &FirstPersonControllerComponentRequests::SetEnableGroundQueryCache)
+                ->Event("Get Ground Query Cache Move Fraction", &FirstPersonControllerComponentRequests::GetGroundQueryCacheMoveFraction)
+                ->Event("Set Ground Query Cache Move Fraction", &FirstPersonControllerComponentRequests::SetGroundQueryCacheMoveFraction)
+                ->Event("Get Ground Query Cache Refresh Ticks", &FirstPersonControllerComponentRequests::GetGroundQueryCacheRefreshTicks)
+                ->Event("Set Ground Query Cache Refresh Ticks", &FirstPersonControllerComponentRequests::SetGroundQueryCacheRefreshTicks)
+                ->Event("Get Tick Ground Cache Hits", &FirstPersonControllerComponentRequests::GetTickGroundCacheHits)
+                ->Event("Get Tick Ground Cache Misses", &FirstPersonControllerComponentRequests::GetTickGroundCacheMisses)
+                ->Event("Get Tick Batched Scene Query Count", &FirstPersonControllerComponentRequests::GetTickBatchedSceneQueryCount)
+                ->Event("Get Enable Ground Query Batch", &FirstPersonControllerComponentRequests::GetEnableGroundQueryBatch)
+                ->Event("Set Enable Ground Query Batch", &FirstPersonControllerComponentRequests::SetEnableGroundQueryBatch)
                 ->Event("Not Autonomous So Disconnect", &FirstPersonControllerComponentRequests::NotAutonomousSoDisconnect);
 
             bc->Class<FirstPersonControllerComponent>("First Person Controller")
@@ -1308,7 +1524,7 @@ namespace FirstPersonController
         // AZ_Printf("First Person Controller Component", "Activate: m_cameraSmoothFollow=%s",
         //     m_cameraSmoothFollow ? "true" : "false");
 
-        AZ::TickBus::Handler::BusConnect();
+        FrameStageConnect(FrameStage::Controller);
 #ifdef NETWORKFPC
         NetworkFPCControllerNotificationBus::Handler::BusConnect(GetEntityId());
 #endif
@@ -1381,38 +1597,20 @@ namespace FirstPersonController
             &FirstPersonControllerComponentNotificationBus::Events::OnFPCActivated, GetEntityId());
 
         if (m_networkFPCControllerObject != nullptr && (m_isServer || m_isHost))
-        {
-            GetPlayerStringNetEntityIdsOnServer();
-            GetBotStringNetEntityIdsOnServer();
-#ifdef NETWORKFPC
-            m_networkFPCControllerObject->SetBotStringNetEntityIds(m_botStringNetEntityIds);
-            m_networkFPCControllerObject->SetPlayerStringNetEntityIds(m_playerStringNetEntityIds);
-#endif
-        }
-        else if (m_isNetBot)
-        {
-            GetBotStringNetEntityIdsOnServer();
-        }
+            SetPlayerBotStringNetEntityIdsProperties();
     }
 
     void FirstPersonControllerComponent::Deactivate()
     {
         InputEventNotificationBus::MultiHandler::BusDisconnect();
-        AZ::TickBus::Handler::BusDisconnect();
+        FrameStageDisconnect();
 #ifdef NETWORKFPC
         NetworkFPCControllerNotificationBus::Handler::BusDisconnect();
 #endif
         InputChannelEventListener::Disconnect();
         FirstPersonControllerComponentRequestBus::Handler::BusDisconnect();
-        if (m_isServer || m_isHost)
-        {
-            GetPlayerStringNetEntityIdsOnServer();
-            GetBotStringNetEntityIdsOnServer();
-        }
-        else if (m_isNetBot)
-        {
-            GetBotStringNetEntityIdsOnServer();
-        }
+        m_inputTrace.Stop();
+        RemoveCharacterOnServer();
         Camera::CameraNotificationBus::Handler::BusDisconnect();
         AZ::EntityBus::Handler::BusDisconnect();
 
@@ -1423,6 +1621,10 @@ namespace FirstPersonController
             m_sceneSimulationFinishHandler.Disconnect();
         }
 
+        LeaveIdleSleep();
+        InvalidateGroundQueryCache();
+        m_reprocessingQueryCache = {};
+        m_cameraPose.Unbind();
         m_activeCameraEntity = nullptr;
     }
 
@@ -1518,6 +1720,7 @@ namespace FirstPersonController
     {
         // Disconnect prior to connecting since this may be a reassignment
         InputEventNotificationBus::MultiHandler::BusDisconnect();
+        m_inputDispatchTable.Clear();
 
         if (m_controlMap.size() != (sizeof(m_inputNames) / sizeof(AZStd::string*)))
         {
@@ -1529,6 +1732,7 @@ namespace FirstPersonController
             {
                 *(it_event.first) = StartingPointInput::InputEventNotificationId(
                     (m_inputNames[std::distance(m_controlMap.begin(), m_controlMap.find(it_event.first))])->c_str());
+                m_inputDispatchTable.Add(*(it_event.first), it_event.second);
                 if (!m_networkFPCEnabled)
                     InputEventNotificationBus::MultiHandler::BusConnect(*(it_event.first));
             }
@@ -1557,16 +1761,7 @@ namespace FirstPersonController
             return;
         }
 
-        for (auto& it_event : m_controlMap)
-        {
-            if (*inputId == *(it_event.first) && !(*(it_event.first) == m_sprintEventId))
-            {
-                *(it_event.second) = value;
-                return;
-                // print the local user ID and the action name CRC
-                // AZ_Printf("Pressed", it_event.first->ToString().c_str());
-            }
-        }
+        m_inputDispatchTable.Write(*inputId, value);
     }
 
     void FirstPersonControllerComponent::OnReleased(float value)
@@ -1582,16 +1777,7 @@ namespace FirstPersonController
             return;
         }
 
-        for (auto& it_event : m_controlMap)
-        {
-            if (*inputId == *(it_event.first))
-            {
-                *(it_event.second) = value;
-                return;
-                // print the local user ID and the action name CRC
-                // AZ_Printf("Released", it_event.first->ToString().c_str());
-            }
-        }
+        m_inputDispatchTable.Write(*inputId, value);
     }
 
     void FirstPersonControllerComponent::OnHeld(float value)
@@ -1602,11 +1788,13 @@ namespace FirstPersonController
 
         if (*inputId == m_rotateYawEventId)
         {
-            m_yawValue = value;
+            if (!m_rawMouseLook)
+                m_yawValue = value;
         }
         else if (*inputId == m_rotatePitchEventId)
         {
-            m_pitchValue = value;
+            if (!m_rawMouseLook)
+                m_pitchValue = value;
         }
         // Repeatedly update the sprint value since we are setting it to 1 under certain movement conditions
         else if (*inputId == m_sprintEventId)
@@ -1644,6 +1832,8 @@ namespace FirstPersonController
         // AZ_Printf("First Person Controller Component", "OnInputChannelEventFiltered");
         if (AzFramework::InputDeviceGamepad::IsGamepadDevice(deviceId))
             OnGamepadEvent(inputChannel);
+        else if (m_rawMouseLook && AzFramework::InputDeviceMouse::IsMouseDevice(deviceId))
+            OnRawMouseEvent(inputChannel);
 
         return false;
     }
@@ -1688,14 +1878,23 @@ namespace FirstPersonController
         }
     }
 
-    int FirstPersonControllerComponent::GetTickOrder()
+    void FirstPersonControllerComponent::OnRawMouseEvent(const AzFramework::InputChannel& inputChannel)
     {
-        return AZ::TICK_PRE_RENDER;
+        const AzFramework::InputChannelId& channelId = inputChannel.GetInputChannelId();
+        const AZ::s64 timeUs = static_cast<AZ::s64>(AZ::GetElapsedTimeUs());
+
+        if (channelId == AzFramework::InputDeviceMouse::Movement::X)
+            m_rawMouseLookAccumulator.AddSample(timeUs, inputChannel.GetValue(), 0.f);
+        else if (channelId == AzFramework::InputDeviceMouse::Movement::Y)
+            m_rawMouseLookAccumulator.AddSample(timeUs, 0.f, inputChannel.GetValue());
     }
 
-    void FirstPersonControllerComponent::OnTick(float deltaTime, AZ::ScriptTimePoint)
+    void FirstPersonControllerComponent::OnFrameStage([[maybe_unused]] const FrameStage stage, const float deltaTime)
     {
         ProcessInput(deltaTime, 0);
+
+        // The batch is cleared once the stage is done
+        m_groundQueryBatch = nullptr;
     }
 
     void FirstPersonControllerComponent::OnNetworkTickStart(const float deltaTime, const bool server, const AZ::EntityId& entityId)
@@ -1717,6 +1916,7 @@ namespace FirstPersonController
             return;
         if (!((m_isHost && server) || (m_isServer && !server)))
         {
+            ++m_tickStats.m_busEvents;
             FirstPersonControllerComponentNotificationBus::Broadcast(
                 &FirstPersonControllerComponentNotificationBus::Events::OnNetworkFPCTickStart,
                 (deltaTime * m_physicsTimestepScaleFactor),
@@ -1725,7 +1925,10 @@ namespace FirstPersonController
             if (!m_networkFPCEnabled)
                 NetworkFPCControllerRequestBus::BroadcastResult(m_networkFPCEnabled, &NetworkFPCControllerRequestBus::Events::GetEnabled);
 #endif
+            if (auto* fpcSystem = FirstPersonControllerInterface::Get())
+                fpcSystem->BeginTickStage(TickStage::NetworkTick);
             ProcessInput(deltaTime, 2);
+            m_groundQueryBatch = nullptr;
         }
     }
 
@@ -1736,10 +1939,13 @@ namespace FirstPersonController
         if (!m_isServer)
             CaptureCharacterEyeTranslation();
         if (!((m_isHost && server) || (m_isServer && !server)))
+        {
+            ++m_tickStats.m_busEvents;
             FirstPersonControllerComponentNotificationBus::Broadcast(
                 &FirstPersonControllerComponentNotificationBus::Events::OnNetworkFPCTickFinish,
                 (deltaTime * m_physicsTimestepScaleFactor),
                 GetEntityId());
+        }
         m_prevNetworkFPCDeltaTime = deltaTime * m_physicsTimestepScaleFactor;
     }
     void FirstPersonControllerComponent::OnAutonomousClientActivated([[maybe_unused]] const AZ::EntityId& entityId)
@@ -1760,17 +1966,23 @@ namespace FirstPersonController
 
     void FirstPersonControllerComponent::OnSceneSimulationStart(float physicsTimestep)
     {
+        ++m_tickStats.m_busEvents;
         FirstPersonControllerComponentNotificationBus::Broadcast(
             &FirstPersonControllerComponentNotificationBus::Events::OnPhysicsTimestepStart,
             (physicsTimestep * m_physicsTimestepScaleFactor),
             GetEntityId());
+
+        if (auto* fpcSystem = FirstPersonControllerInterface::Get())
+            fpcSystem->BeginTickStage(TickStage::PhysicsTimestep);
         ProcessInput(physicsTimestep, 1);
+        m_groundQueryBatch = nullptr;
     }
 
     void FirstPersonControllerComponent::OnSceneSimulationFinish(float physicsTimestep)
     {
         if (!m_networkFPCEnabled)
             CaptureCharacterEyeTranslation();
+        ++m_tickStats.m_busEvents;
         FirstPersonControllerComponentNotificationBus::Broadcast(
             &FirstPersonControllerComponentNotificationBus::Events::OnPhysicsTimestepFinish,
             (physicsTimestep * m_physicsTimestepScaleFactor),
@@ -1805,13 +2017,12 @@ namespace FirstPersonController
 
             if (!IsCameraChildOfCharacter())
             {
-                AZ::TransformInterface* characterTransform = GetEntity()->GetTransform();
-                AZ::TransformInterface* cameraTransform = m_activeCameraEntity->GetTransform();
-                cameraTransform->SetWorldRotation(AZ::Vector3(
-                    cameraTransform->GetWorldRotation().GetX(),
-                    cameraTransform->GetWorldRotation().GetY(),
-                    characterTransform->GetWorldRotation().GetZ()));
-                m_cameraYaw = cameraTransform->GetWorldRotation().GetZ();
+                // Face the camera the same way as the character
+                CameraPoseCompositor* cameraPose = GetCameraPose();
+                const AZ::Vector3 cameraWorldRotation = cameraPose->GetWorldRotation().GetEulerRadians();
+                cameraPose->SetWorldRotation(AZ::Quaternion::CreateFromEulerRadiansXYZ(AZ::Vector3(
+                    cameraWorldRotation.GetX(), cameraWorldRotation.GetY(), GetEntity()->GetTransform()->GetWorldRotation().GetZ())));
+                m_cameraYaw = cameraPose->GetWorldRotation().GetEulerRadians().GetZ();
             }
         }
         else
@@ -1825,7 +2036,11 @@ namespace FirstPersonController
         }
 
         if (m_makeCameraChildOfCharacter && !IsCameraChildOfCharacter())
+        {
+            // Write out the pending pose first, the compositor takes the reparented pose as its base afterwards
+            m_cameraPose.Apply();
             AZ::TransformBus::Event(m_cameraEntityId, &AZ::TransformBus::Events::SetParent, GetEntityId());
+        }
     }
 
     AZ::Entity* FirstPersonControllerComponent::GetEntityPtr(const AZ::EntityId& entityId) const
@@ -1848,14 +2063,13 @@ namespace FirstPersonController
 
         // Set initial world translation for smooth following
         if (m_addVelocityForTimestepVsTick && m_cameraSmoothFollow)
-        {
-            AZ::TransformBus::Event(m_cameraEntityId, &AZ::TransformBus::Events::SetWorldTranslation, m_currentCharacterEyeTranslation);
-            m_cameraTranslationOverwritten = true;
-        }
+            GetCameraPose()->SetWorldTranslation(m_currentCharacterEyeTranslation);
     }
 
     void FirstPersonControllerComponent::LerpCameraToCharacter(const float deltaTime)
     {
+        FPC_PROFILE_STAGE(LerpCameraToCharacter);
+
         if (m_networkFPCEnabled && m_isServer || m_isNetBot)
             return;
 
@@ -1885,10 +2099,23 @@ namespace FirstPersonController
         else
             alpha = AZ::GetMin(m_physicsTimeAccumulator / m_prevNetworkFPCDeltaTime, 1.f);
 
+        if (m_correctionReconciling)
+            FinishCorrectionReconciliation();
+        DecayCorrectionVisualOffset(deltaTime);
+
         // Interpolate translation
-        const AZ::Vector3 interpolatedCameraTranslation = m_prevCharacterEyeTranslation.Lerp(m_currentCharacterEyeTranslation, alpha);
-        AZ::TransformBus::Event(m_cameraEntityId, &AZ::TransformBus::Events::SetWorldTranslation, interpolatedCameraTranslation);
-        m_cameraTranslationOverwritten = true;
+        const AZ::Vector3 interpolatedCameraTranslation =
+            m_prevCharacterEyeTranslation.Lerp(m_currentCharacterEyeTranslation, alpha) + m_correctionVisualOffset;
+        GetCameraPose()->SetWorldTranslation(interpolatedCameraTranslation);
+    }
+
+    CameraPoseCompositor* FirstPersonControllerComponent::GetCameraPose()
+    {
+        if (m_activeCameraEntity == nullptr)
+            return nullptr;
+
+        m_cameraPose.Bind(m_activeCameraEntity->GetId());
+        return &m_cameraPose;
     }
 
     // Helper function to check if camera is a child of the character
@@ -1909,14 +2136,69 @@ namespace FirstPersonController
 
     void FirstPersonControllerComponent::ResetCameraToCharacter()
     {
+        FPC_PROFILE_STAGE(ResetCameraToCharacter);
+
         if (m_networkFPCEnabled && m_isServer || m_isNetBot)
             return;
         // Set the translation of the camera to where the character is on each physics timestep
         if (m_addVelocityForTimestepVsTick && m_cameraSmoothFollow && m_activeCameraEntity)
+            GetCameraPose()->SetWorldTranslation(m_currentCharacterEyeTranslation + m_correctionVisualOffset);
+    }
+
+    void FirstPersonControllerComponent::BeginCorrectionReconciliation()
+    {
+        // Remember where the camera was following before the corrected inputs are replayed
+        m_correctionEyeTranslation = m_currentCharacterEyeTranslation;
+        m_correctionReconciling = true;
+    }
+
+    void FirstPersonControllerComponent::FinishCorrectionReconciliation()
+    {
+        m_correctionReconciling = false;
+
+        const AZ::Vector3 correction = m_correctionEyeTranslation - m_currentCharacterEyeTranslation;
+        const float magnitude = correction.GetLength();
+        ++m_correctionStats.m_count;
+        m_correctionStats.m_magnitudeSum += magnitude;
+        m_correctionStats.m_magnitudeMax = AZ::GetMax(m_correctionStats.m_magnitudeMax, magnitude);
+        m_correctionStats.m_magnitudeLast = magnitude;
+
+        // Large corrections, such as teleports, are applied to the camera immediately
+        if (m_correctionSmoothingMode == CorrectionSmoothingMode::None || magnitude > m_correctionSmoothingMaxDistance)
+        {
+            ++m_correctionStats.m_snapCount;
+            m_correctionVisualOffset = AZ::Vector3::CreateZero();
+            m_correctionVisualOffsetVelocity = AZ::Vector3::CreateZero();
+            return;
+        }
+
+        m_correctionVisualOffset += correction;
+    }
+
+    void FirstPersonControllerComponent::DecayCorrectionVisualOffset(const float deltaTime)
+    {
+        if (m_correctionVisualOffset.IsZero())
+            return;
+
+        if (m_correctionSmoothingTime <= 0.f || m_correctionVisualOffset.GetLengthSq() < 1e-8f)
+        {
+            m_correctionVisualOffset = AZ::Vector3::CreateZero();
+            m_correctionVisualOffsetVelocity = AZ::Vector3::CreateZero();
+            return;
+        }
+
+        if (m_correctionSmoothingMode == CorrectionSmoothingMode::CriticallyDampedSpring)
         {
-            AZ::TransformBus::Event(m_cameraEntityId, &AZ::TransformBus::Events::SetWorldTranslation, m_currentCharacterEyeTranslation);
-            m_cameraTranslationOverwritten = true;
+            // Critically damped spring towards zero offset, integrated with a stable closed-form approximation
+            const float omega = 2.f / m_correctionSmoothingTime;
+            const float x = omega * deltaTime;
+            const float decay = 1.f / (1.f + x + 0.48f * x * x + 0.235f * x * x * x);
+            const AZ::Vector3 change = (m_correctionVisualOffsetVelocity + omega * m_correctionVisualOffset) * deltaTime;
+            m_correctionVisualOffsetVelocity = (m_correctionVisualOffsetVelocity - omega * change) * decay;
+            m_correctionVisualOffset = (m_correctionVisualOffset + change) * decay;
         }
+        else
+            m_correctionVisualOffset *= AZStd::exp(-deltaTime / m_correctionSmoothingTime);
     }
 
     void FirstPersonControllerComponent::CaptureCharacterEyeTranslation()
@@ -1958,8 +2240,25 @@ namespace FirstPersonController
             m_newLookRotationDelta = targetLookRotationDelta;
     }
 
+    void FirstPersonControllerComponent::ConsumeRawMouseLook()
+    {
+        AZ::s64 oldestTimeUs = 0;
+        const AZ::s64 nowUs = static_cast<AZ::s64>(AZ::GetElapsedTimeUs());
+        if (m_rawMouseLookAccumulator.Consume(nowUs, false, m_yawValue, m_pitchValue, oldestTimeUs))
+            RecordInputToCameraLatency(oldestTimeUs, 0.f);
+    }
+
+    void FirstPersonControllerComponent::RecordInputToCameraLatency(const AZ::s64 inputTimeUs, const float renderDelay)
+    {
+        const AZ::s64 nowUs = static_cast<AZ::s64>(AZ::GetElapsedTimeUs());
+        m_inputToCameraLatency = static_cast<float>(nowUs - inputTimeUs) * 1e-6f + renderDelay;
+        m_inputToCameraLatencyMax = AZ::GetMax(m_inputToCameraLatencyMax, m_inputToCameraLatency);
+    }
+
     void FirstPersonControllerComponent::UpdateRotation(const float deltaTime, const AZ::u8 tickTimestepNetwork)
     {
+        FPC_PROFILE_STAGE(UpdateRotation);
+
         if (!m_enableCameraCharacterRotation)
             return;
 
@@ -1991,15 +2290,16 @@ namespace FirstPersonController
             // Retain the look rotation delta in NetworkFPC, to be retrieved on next frame tick
             if (m_networkFPCEnabled && m_networkFPCControllerObject != nullptr)
             {
-                m_networkFPCRotationSliceAccumulator = 0.f;
                 if (!m_networkFPCCameraAligned)
                 {
                     m_cameraYaw = m_currentHeading;
                     m_networkFPCCameraAligned = true;
                 }
+                // Replayed inputs were already pushed when first processed, pushing them again would over-rotate the camera
+                if (!m_reprocessingInput)
+                    PushNetworkFPCLookRotationSample(newLookRotationDelta);
 #ifdef NETWORKFPC
                 m_networkFPCControllerObject->SetLookRotationDelta(newLookRotationDelta);
-                m_networkFPCControllerObject->SetYawDeltaOvershoot(0.f);
 #endif
             }
 
@@ -2009,32 +2309,24 @@ namespace FirstPersonController
         }
         else if (m_networkFPCControllerObject != nullptr)
         {
-            // Retrieve the look rotation delta from NetworkFPC, only apply it when there's a new value
-            const float slice = AZ::GetMax(m_prevNetworkFPCDeltaTime / deltaTime, 1.f);
-            m_networkFPCRotationSliceAccumulator += 1.f / slice;
-#ifdef NETWORKFPC
-            newLookRotationDelta = m_networkFPCControllerObject->GetLookRotationDelta() / slice;
-            // Compensate the character's yaw from the camera overshooting due to network jitter
-            if (m_networkFPCRotationSliceAccumulator > 1.f)
-                m_networkFPCControllerObject->SetYawDeltaOvershoot((m_cameraYaw + newLookRotationDelta.GetZ()) - m_currentHeading);
-#endif
+            // Rotate the camera by the change in the buffered look rotation, sampled one network tick in the past
+            newLookRotationDelta = SampleNetworkFPCLookRotation(deltaTime);
         }
 
-        if (m_activeCameraEntity)
+        CameraPoseCompositor* cameraPose = GetCameraPose();
+        if (cameraPose != nullptr)
         {
             m_cameraRotationTransform = m_activeCameraEntity->GetTransform();
 
             if (IsCameraChildOfCharacter())
             {
                 // Apply pitch to camera's local rotation, yaw follows the parent character entity
-                m_cameraRotationTransform->SetLocalRotation(AZ::Vector3(
-                    AZ::GetClamp(
-                        m_cameraRotationTransform->GetLocalRotation().GetX() + newLookRotationDelta.GetX(),
-                        m_cameraPitchMinAngle,
-                        m_cameraPitchMaxAngle),
-                    m_cameraRotationTransform->GetLocalRotation().GetY(),
-                    m_cameraRotationTransform->GetLocalRotation().GetZ()));
-                m_cameraYaw = m_cameraRotationTransform->GetLocalRotation().GetZ();
+                const AZ::Vector3 cameraLocalRotation = cameraPose->GetLocalRotation().GetEulerRadians();
+                cameraPose->SetLocalRotation(AZ::Quaternion::CreateFromEulerRadiansXYZ(AZ::Vector3(
+                    AZ::GetClamp(cameraLocalRotation.GetX() + newLookRotationDelta.GetX(), m_cameraPitchMinAngle, m_cameraPitchMaxAngle),
+                    cameraLocalRotation.GetY(),
+                    cameraLocalRotation.GetZ())));
+                m_cameraYaw = cameraPose->GetLocalRotation().GetEulerRadians().GetZ();
             }
             else if (m_addVelocityForTimestepVsTick && m_cameraSmoothFollow)
             {
@@ -2061,8 +2353,7 @@ namespace FirstPersonController
                 if (GetIsNetworkingActive() && !m_isNetBot && !m_isServer)
 #endif
                 {
-                    m_cameraRotationTransform->SetLocalRotationQuaternion(yawRotation * pitchRotation * rollRotation);
-                    m_cameraRotationOverwritten = true;
+                    cameraPose->SetLocalRotation(yawRotation * pitchRotation * rollRotation);
                 }
             }
             else
@@ -2077,8 +2368,7 @@ namespace FirstPersonController
                 if (GetIsNetworkingActive() && !m_isNetBot && !m_isServer)
 #endif
                 {
-                    m_cameraRotationTransform->SetLocalRotationQuaternion(yawRotation * pitchRotation);
-                    m_cameraRotationOverwritten = true;
+                    cameraPose->SetLocalRotation(yawRotation * pitchRotation);
                 }
             }
         }
@@ -2094,129 +2384,114 @@ namespace FirstPersonController
         else
             m_scriptSetCurrentHeadingTick = false;
 
-        if (m_activeCameraEntity)
-            m_currentPitch = m_activeCameraEntity->GetTransform()->GetWorldRotation().GetX();
+        if (cameraPose != nullptr)
+            m_currentPitch = cameraPose->GetWorldRotation().GetEulerRadians().GetX();
     }
 
-    // Here target velocity is with respect to the character's frame of reference when m_instantVelocityRotation == true
-    // and it's with respect to the world when m_instantVelocityRotation == false
-    AZ::Vector2 FirstPersonControllerComponent::LerpVelocityXY(const AZ::Vector2& targetVelocityXY, const float deltaTime)
+    void FirstPersonControllerComponent::PushNetworkFPCLookRotationSample(const AZ::Vector3& lookRotationDelta)
     {
-        m_totalLerpTime = m_prevApplyVelocityXY.GetDistance(targetVelocityXY) / m_accel;
-
-        if (m_totalLerpTime == 0.f)
+        // The oldest sample is the base that the camera interpolates from, samples store the rotation remaining ahead of the camera.
+        // The first sample seeds the ring on its own, and is held until the render time reaches it
+        if (m_networkFPCLookRotationSamples.empty())
         {
-            m_accelerating = false;
-            m_decelerationFactorApplied = false;
-            m_opposingDecelFactorApplied = false;
-            return m_prevApplyVelocityXY;
+            m_networkFPCLookRotationSamples.push_back({ 0.f, lookRotationDelta });
+            return;
         }
+        if (m_networkFPCLookRotationSamples.size() >= NetworkFPCLookRotationSamplesMax)
+            m_networkFPCLookRotationSamples.pop_front();
 
-        // Apply the sprint factor to the acceleration (dt) based on the sprint having been (recently) pressed
-        const float lastLerpTime = m_lerpTime;
-
-        float lerpDeltaTime =
-            (m_sprintAccumulatedAccel > 0.f || m_sprintVelocityAdjust != 1.f) ? deltaTime * m_sprintAccelAdjust : deltaTime;
-        if (m_sprintAccelValue < 1.f && m_sprintAccumulatedAccel > 0.f)
-            lerpDeltaTime = deltaTime * m_sprintAccelAdjust;
-
-        lerpDeltaTime *= m_grounded ? 1.f : m_jumpAccelFactor;
-
-        m_lerpTime += lerpDeltaTime;
-
-        if (m_lerpTime >= m_totalLerpTime)
-            m_lerpTime = m_totalLerpTime;
-
-        // Lerp the velocity from the last applied velocity to the target velocity
-        AZ::Vector2 newVelocityXY = m_prevApplyVelocityXY.Lerp(targetVelocityXY, m_lerpTime / m_totalLerpTime);
-
-        // Decelerate at a different rate than the acceleration
-        if (newVelocityXY.GetLength() < m_applyVelocityXY.GetLength())
-        {
-            m_accelerating = false;
-            m_decelerationFactorApplied = true;
-            // Get the current velocity vector with respect to the character's local coordinate system
-            const AZ::Vector2 applyVelocityHeading =
-                AZ::Vector2(AZ::Quaternion::CreateRotationZ(-m_currentHeading).TransformVector(AZ::Vector3(m_applyVelocityXY)));
+        m_networkFPCLookRotationSamples.push_back({ 0.f, m_networkFPCLookRotationSamples.back().m_lookRotation + lookRotationDelta });
+    }
 
-            // Compare the direction of the current velocity vector against the desired direction
-            // and if it's greater than 90 degrees then decelerate even more
-            if (targetVelocityXY.GetLength() != 0.f && m_instantVelocityRotation
-                    ? (abs(applyVelocityHeading.AngleSafe(targetVelocityXY)) > AZ::Constants::HalfPi)
-                    : (abs(m_applyVelocityXY.AngleSafe(targetVelocityXY)) > AZ::Constants::HalfPi))
-            {
-                m_opposingDecelFactorApplied = true;
-                m_decelerationFactorApplied = false;
-                // Compute the deceleration factor based on the magnitude of the target velocity
-                float greatestScale = m_forwardScale;
-                for (float scale : { m_forwardScale, m_backScale, m_leftScale, m_rightScale })
-                    if (greatestScale < abs(scale))
-                        greatestScale = abs(scale);
-
-                AZ::Vector2 targetVelocityXYLocal = targetVelocityXY;
-                if (!m_instantVelocityRotation)
-                    targetVelocityXYLocal =
-                        AZ::Vector2(AZ::Quaternion::CreateRotationZ(-m_currentHeading).TransformVector(AZ::Vector3(targetVelocityXY)));
-
-                if (m_standing || m_sprintWhileCrouched)
-                    m_decelerationFactor =
-                        (m_decel +
-                         (m_opposingDecel - m_decel) * targetVelocityXYLocal.GetLength() /
-                             (m_speed * (1.f + (m_sprintVelocityAdjust - 1.f)) * greatestScale));
-                else
-                    m_decelerationFactor =
-                        (m_decel +
-                         (m_opposingDecel - m_decel) * targetVelocityXYLocal.GetLength() / (m_speed * m_crouchScale * greatestScale));
-            }
-            else
-            {
-                m_decelerationFactor = m_decel;
-                m_opposingDecelFactorApplied = false;
-            }
+    AZ::Vector3 FirstPersonControllerComponent::SampleNetworkFPCLookRotation(const float deltaTime)
+    {
+        for (NetworkFPCLookRotationSample& sample : m_networkFPCLookRotationSamples)
+            sample.m_time -= deltaTime;
 
-            // Use the deceleration factor to get the lerp time closer to the total lerp time at a faster rate
-            m_lerpTime = lastLerpTime + lerpDeltaTime * m_decelerationFactor;
+        // Drop the samples that are older than the one preceding the render time
+        const float renderTime = -m_prevNetworkFPCDeltaTime;
+        while (m_networkFPCLookRotationSamples.size() > 1 && m_networkFPCLookRotationSamples[1].m_time <= renderTime)
+            m_networkFPCLookRotationSamples.pop_front();
 
-            if (m_lerpTime >= m_totalLerpTime)
-                m_lerpTime = m_totalLerpTime;
+        if (m_networkFPCLookRotationSamples.empty() || m_networkFPCLookRotationSamples.front().m_time > renderTime)
+            return AZ::Vector3::CreateZero();
 
-            AZ::Vector2 newVelocityXYDecel = m_prevApplyVelocityXY.Lerp(targetVelocityXY, m_lerpTime / m_totalLerpTime);
-            if (newVelocityXYDecel.GetLength() < m_applyVelocityXY.GetLength())
-                newVelocityXY = newVelocityXYDecel;
-        }
-        else
+        // Interpolate towards the next sample, or hold the newest one without extrapolating past it
+        AZ::Vector3 lookRotation = m_networkFPCLookRotationSamples.front().m_lookRotation;
+        if (m_networkFPCLookRotationSamples.size() > 1)
         {
-            m_accelerating = true;
-            m_decelerationFactorApplied = false;
-            m_opposingDecelFactorApplied = false;
+            const NetworkFPCLookRotationSample& from = m_networkFPCLookRotationSamples[0];
+            const NetworkFPCLookRotationSample& to = m_networkFPCLookRotationSamples[1];
+            lookRotation = from.m_lookRotation.Lerp(to.m_lookRotation, (renderTime - from.m_time) / (to.m_time - from.m_time));
         }
 
-        if (!AZ::IsClose(m_sprintAccelAdjust, 1.f))
-        {
-            if (!AZ::IsClose(m_sprintVelocityAdjust, 1.f) || (newVelocityXY.GetLength() < m_applyVelocityXY.GetLength()))
-                m_sprintAccumulatedAccel += (newVelocityXY.GetLength() - m_applyVelocityXY.GetLength());
-            else
-                m_sprintAccumulatedAccel = 0.f;
+        for (NetworkFPCLookRotationSample& sample : m_networkFPCLookRotationSamples)
+            sample.m_lookRotation -= lookRotation;
 
-            if (m_sprintAccumulatedAccel < 0.f)
-                m_sprintAccumulatedAccel = 0.f;
-        }
-        else
-            m_sprintAccumulatedAccel = 0.f;
+        return lookRotation;
+    }
+
+    // Here target velocity is with respect to the character's frame of reference when m_instantVelocityRotation == true
+    // and it's with respect to the world when m_instantVelocityRotation == false
+    AZ::Vector2 FirstPersonControllerComponent::LerpVelocityXY(const AZ::Vector2& targetVelocityXY, const float deltaTime)
+    {
+        CharacterMotionCore::VelocityXYParams params;
+        params.m_accel = m_accel;
+        params.m_decel = m_decel;
+        params.m_opposingDecel = m_opposingDecel;
+        params.m_speed = m_speed;
+        params.m_crouchScale = m_crouchScale;
+        params.m_jumpAccelFactor = m_jumpAccelFactor;
+        params.m_forwardScale = m_forwardScale;
+        params.m_backScale = m_backScale;
+        params.m_leftScale = m_leftScale;
+        params.m_rightScale = m_rightScale;
+        params.m_instantVelocityRotation = m_instantVelocityRotation;
+        params.m_sprintWhileCrouched = m_sprintWhileCrouched;
+
+        CharacterMotionCore::VelocityXYState state;
+        state.m_prevApplyVelocityXY = m_prevApplyVelocityXY;
+        state.m_applyVelocityXY = m_applyVelocityXY;
+        state.m_currentHeading = m_currentHeading;
+        state.m_sprintAccelAdjust = m_sprintAccelAdjust;
+        state.m_sprintVelocityAdjust = m_sprintVelocityAdjust;
+        state.m_sprintAccelValue = m_sprintAccelValue;
+        state.m_standing = m_standing;
+        state.m_totalLerpTime = m_totalLerpTime;
+        state.m_lerpTime = m_lerpTime;
+        state.m_decelerationFactor = m_decelerationFactor;
+        state.m_sprintAccumulatedAccel = m_sprintAccumulatedAccel;
+        state.m_accelerating = m_accelerating;
+        state.m_decelerationFactorApplied = m_decelerationFactorApplied;
+        state.m_opposingDecelFactorApplied = m_opposingDecelFactorApplied;
+
+        CharacterMotionCore::QueryResults queryResults;
+        queryResults.m_grounded = m_grounded;
+
+        const AZ::Vector2 newVelocityXY = CharacterMotionCore::LerpVelocityXY(state, params, queryResults, targetVelocityXY, deltaTime);
+
+        m_totalLerpTime = state.m_totalLerpTime;
+        m_lerpTime = state.m_lerpTime;
+        m_decelerationFactor = state.m_decelerationFactor;
+        m_sprintAccumulatedAccel = state.m_sprintAccumulatedAccel;
+        m_accelerating = state.m_accelerating;
+        m_decelerationFactorApplied = state.m_decelerationFactorApplied;
+        m_opposingDecelFactorApplied = state.m_opposingDecelFactorApplied;
+
+        // The lerp hasn't begun when the target is the previously applied velocity
+        if (m_totalLerpTime == 0.f)
+            return newVelocityXY;
 
         if (m_applyVelocityXY == AZ::Vector2::CreateZero())
-            FirstPersonControllerComponentNotificationBus::Event(
-                GetEntityId(), &FirstPersonControllerComponentNotifications::OnStartedMoving);
+            Notify(&FirstPersonControllerComponentNotifications::OnStartedMoving);
 
         if (newVelocityXY == targetVelocityXY)
         {
-            FirstPersonControllerComponentNotificationBus::Event(
-                GetEntityId(), &FirstPersonControllerComponentNotifications::OnTargetVelocityReached);
+            Notify(&FirstPersonControllerComponentNotifications::OnTargetVelocityReached);
 
             const bool vXCrossYPos = (m_velocityXCrossYDirection.GetZ() >= 0.f);
             if (newVelocityXY.GetLength() == 0.f)
-                FirstPersonControllerComponentNotificationBus::Event(
-                    GetEntityId(), &FirstPersonControllerComponentNotifications::OnStopped);
+                Notify(&FirstPersonControllerComponentNotifications::OnStopped);
             else if (
                 vXCrossYPos &&
                 (AZ::IsClose(
@@ -2224,8 +2499,7 @@ namespace FirstPersonController
                     m_speed *
                         CreateEllipseScaledVector(newVelocityXY.GetNormalized(), m_forwardScale, m_backScale, m_leftScale, m_rightScale)
                             .GetLength())))
-                FirstPersonControllerComponentNotificationBus::Event(
-                    GetEntityId(), &FirstPersonControllerComponentNotifications::OnTopWalkSpeedReached);
+                Notify(&FirstPersonControllerComponentNotifications::OnTopWalkSpeedReached);
             else if (
                 !vXCrossYPos &&
                 (AZ::IsClose(
@@ -2233,8 +2507,7 @@ namespace FirstPersonController
                     m_speed *
                         CreateEllipseScaledVector((-newVelocityXY).GetNormalized(), m_forwardScale, m_backScale, m_leftScale, m_rightScale)
                             .GetLength())))
-                FirstPersonControllerComponentNotificationBus::Event(
-                    GetEntityId(), &FirstPersonControllerComponentNotifications::OnTopWalkSpeedReached);
+                Notify(&FirstPersonControllerComponentNotifications::OnTopWalkSpeedReached);
             else if (
                 vXCrossYPos &&
                 (AZ::IsClose(
@@ -2247,8 +2520,7 @@ namespace FirstPersonController
                             m_sprintScaleLeft * m_leftScale,
                             m_sprintScaleRight * m_rightScale)
                             .GetLength())))
-                FirstPersonControllerComponentNotificationBus::Event(
-                    GetEntityId(), &FirstPersonControllerComponentNotifications::OnTopSprintSpeedReached);
+                Notify(&FirstPersonControllerComponentNotifications::OnTopSprintSpeedReached);
             else if (
                 !vXCrossYPos &&
                 (AZ::IsClose(
@@ -2261,8 +2533,7 @@ namespace FirstPersonController
                             m_sprintScaleLeft * m_leftScale,
                             m_sprintScaleRight * m_rightScale)
                             .GetLength())))
-                FirstPersonControllerComponentNotificationBus::Event(
-                    GetEntityId(), &FirstPersonControllerComponentNotifications::OnTopSprintSpeedReached);
+                Notify(&FirstPersonControllerComponentNotifications::OnTopSprintSpeedReached);
         }
 
         return newVelocityXY;
@@ -2271,33 +2542,13 @@ namespace FirstPersonController
     AZ::Vector2 FirstPersonControllerComponent::CreateEllipseScaledVector(
         const AZ::Vector2& unscaledVector, float forwardScale, float backScale, float leftScale, float rightScale)
     {
-        if (unscaledVector.IsZero())
-            return AZ::Vector2::CreateZero();
-
-        const float x = unscaledVector.GetX();
-        const float y = unscaledVector.GetY();
-        const float length = unscaledVector.GetLength();
-
-        // Select the ellipse radii based on the quadrant
-        const float xScale = (x >= 0.f) ? rightScale : leftScale;
-        const float yScale = (y >= 0.f) ? forwardScale : backScale;
-
-        // Ellipse intersection
-        const float denominatorSquared = (yScale * x) * (yScale * x) + (xScale * y) * (xScale * y);
-
-        // Prevent division by zero if the scales are zero
-        if (denominatorSquared <= 0.f)
-            return AZ::Vector2::CreateZero();
-
-        // Compute the scaling factor
-        const float scale = (xScale * yScale * length) / sqrt(denominatorSquared);
-
-        // Apply the scaling
-        return AZ::Vector2(scale * x, scale * y);
+        return CharacterMotionCore::CreateEllipseScaledVector(unscaledVector, forwardScale, backScale, leftScale, rightScale);
     }
 
     void FirstPersonControllerComponent::ApplyMovingUpInclineXYSpeedFactor()
     {
+        FPC_PROFILE_STAGE(ApplyMovingUpInclineXYSpeedFactor);
+
         if (!m_velocityXCrossYTracksNormal || !m_movingUpInclineSlowed || m_prevTargetVelocity.IsZero())
             return;
 
@@ -2407,6 +2658,8 @@ namespace FirstPersonController
     // Here target velocity is with respect to the character's frame of reference
     void FirstPersonControllerComponent::SprintManager(const AZ::Vector2& targetVelocityXY, const float deltaTime)
     {
+        FPC_PROFILE_STAGE(SprintManager);
+
         // Handle toggling the sprint key when it's enabled
         if (!m_sprintEnableToggle)
             m_sprintInputEngaged = m_sprintEffectiveValue != 0.f ? true : false;
@@ -2477,64 +2730,34 @@ namespace FirstPersonController
 
         if (m_sprintPrevValue == 0.f && !AZ::IsClose(m_sprintVelocityAdjust, 1.f) && m_sprintHeldDuration < m_sprintMaxTime &&
             m_sprintCooldownTimer == 0.f)
-            FirstPersonControllerComponentNotificationBus::Event(
-                GetEntityId(), &FirstPersonControllerComponentNotifications::OnSprintStarted);
+            Notify(&FirstPersonControllerComponentNotifications::OnSprintStarted);
         else if (m_sprintPrevValue == 1.f && !m_sprintInputEngaged && AZ::IsClose(m_sprintVelocityAdjust, 1.f))
-            FirstPersonControllerComponentNotificationBus::Event(
-                GetEntityId(), &FirstPersonControllerComponentNotifications::OnSprintStopped);
+            Notify(&FirstPersonControllerComponentNotifications::OnSprintStopped);
 
         m_sprintPrevValue = m_sprintEffectiveValue;
 
         // If sprint is to be applied then increment the sprint counter
         if (!AZ::IsClose(m_sprintVelocityAdjust, 1.f) && m_sprintHeldDuration < m_sprintMaxTime && m_sprintCooldownTimer == 0.f)
         {
-            m_staminaIncreasing = false;
-
             // Cause the character to stand if trying to sprint while crouched and the setting is enabled
             if (m_crouchSprintCausesStanding && m_crouching && m_grounded)
                 m_crouching = false;
 
             // Figure out which of the scaled sprint velocity directions is the greatest
-            float greatestSprintScale = 1.f;
-            for (const float scale : { m_sprintScaleForward, m_sprintScaleBack, m_sprintScaleLeft, m_sprintScaleRight })
-                if (abs(scale) > abs(greatestSprintScale))
-                    greatestSprintScale = scale;
-
-            if (m_sprintAccelValue >= 1.f)
-            {
-                if (greatestSprintScale >= 1.f)
-                    m_sprintAccelAdjust = (m_sprintAccelValue - 1.f) / (greatestSprintScale - 1.f) * (m_sprintVelocityAdjust - 1.f) + 1.f;
-                else
-                    m_sprintAccelAdjust = (m_sprintAccelValue - 1.f) / (greatestSprintScale) * (m_sprintVelocityAdjust) + 1.f;
-            }
-            else
-            {
-                if (greatestSprintScale >= 1.f)
-                    m_sprintAccelAdjust = (m_sprintAccelValue) / (greatestSprintScale - 1.f) * (m_sprintVelocityAdjust - 1.f);
-                else
-                    m_sprintAccelAdjust = (m_sprintAccelValue) / (greatestSprintScale) * (m_sprintVelocityAdjust);
-            }
+            const float greatestSprintScale =
+                CharacterMotionCore::GreatestScale(1.f, m_sprintScaleForward, m_sprintScaleBack, m_sprintScaleLeft, m_sprintScaleRight);
 
-            if (m_sprintUsesStamina)
-            {
-                m_staminaDecreasing = true;
-                m_sprintHeldDuration += deltaTime * (m_sprintVelocityAdjust - 1.f) / (greatestSprintScale - 1.f);
-            }
-
-            if (m_sprintHeldDuration >= m_sprintMaxTime)
-            {
-                m_sprintHeldDuration = m_sprintMaxTime;
-                FirstPersonControllerComponentNotificationBus::Event(
-                    GetEntityId(), &FirstPersonControllerComponentNotifications::OnStaminaReachedZero);
-            }
+            m_sprintAccelAdjust = CharacterMotionCore::SprintAccelAdjust(m_sprintAccelValue, greatestSprintScale, m_sprintVelocityAdjust);
 
-            m_sprintPause = m_sprintPauseTime;
+            CharacterMotionCore::StaminaState staminaState = GetStaminaState();
+            const AZ::u8 staminaEvents =
+                CharacterMotionCore::DrainStamina(staminaState, GetStaminaParams(), m_sprintVelocityAdjust, greatestSprintScale, deltaTime);
+            SetStaminaState(staminaState);
+            NotifyStaminaEvents(staminaEvents);
         }
         // Otherwise if the sprint velocity isn't applied then decrement the sprint counter
         else
         {
-            m_staminaDecreasing = false;
-
             if (!m_sprintEnableToggle || !m_sprintToggleAutomatically)
                 m_sprintInputEngaged = false;
 
@@ -2542,10 +2765,8 @@ namespace FirstPersonController
             if (!m_sprintStopAccelAdjustCaptured && targetVelocityXY.IsZero())
             {
                 // Figure out which of the scaled sprint velocity directions is the greatest
-                float greatestSprintScale = 0.f;
-                for (const float scale : { m_sprintScaleForward, m_sprintScaleBack, m_sprintScaleLeft, m_sprintScaleRight })
-                    if (abs(scale) > abs(greatestSprintScale))
-                        greatestSprintScale = scale;
+                const float greatestSprintScale =
+                    CharacterMotionCore::GreatestScale(0.f, m_sprintScaleForward, m_sprintScaleBack, m_sprintScaleLeft, m_sprintScaleRight);
 
                 float lastAdjustScale = 1.f;
                 if (m_instantVelocityRotation)
@@ -2591,20 +2812,7 @@ namespace FirstPersonController
                                               .GetLength();
                 }
 
-                if (m_sprintAccelValue >= 1.f)
-                {
-                    if (greatestSprintScale >= 1.f)
-                        m_sprintAccelAdjust = (m_sprintAccelValue - 1.f) / (greatestSprintScale - 1.f) * (lastAdjustScale - 1.f) + 1.f;
-                    else
-                        m_sprintAccelAdjust = (m_sprintAccelValue - 1.f) / (greatestSprintScale) * (lastAdjustScale) + 1.f;
-                }
-                else
-                {
-                    if (greatestSprintScale >= 1.f)
-                        m_sprintAccelAdjust = (m_sprintAccelValue) / (greatestSprintScale - 1.f) * (lastAdjustScale - 1.f);
-                    else
-                        m_sprintAccelAdjust = (m_sprintAccelValue) / (greatestSprintScale) * (lastAdjustScale);
-                }
+                m_sprintAccelAdjust = CharacterMotionCore::SprintAccelAdjust(m_sprintAccelValue, greatestSprintScale, lastAdjustScale);
 
                 m_sprintStopAccelAdjustCaptured = true;
             }
@@ -2617,72 +2825,71 @@ namespace FirstPersonController
                 m_sprintAccelAdjust = 1.f;
             }
 
-            // When the sprint held duration exceeds the maximum sprint time then initiate the cooldown period
-            if (m_sprintHeldDuration >= m_sprintMaxTime && m_sprintCooldownTimer == 0.f)
-            {
+            // Start the cooldown once the stamina is spent, otherwise regenerate it
+            CharacterMotionCore::StaminaState staminaState = GetStaminaState();
+            const AZ::u8 staminaEvents = CharacterMotionCore::RecoverStamina(staminaState, GetStaminaParams(), deltaTime);
+            SetStaminaState(staminaState);
+            if (staminaEvents & CharacterMotionCore::StaminaEventCooldownStarted)
                 m_sprintVelocityAdjust = 1.f;
-                m_sprintCooldownTimer = m_sprintTotalCooldownTime;
-                FirstPersonControllerComponentNotificationBus::Event(
-                    GetEntityId(), &FirstPersonControllerComponentNotifications::OnCooldownStarted);
-            }
+            NotifyStaminaEvents(staminaEvents);
+        }
 
-            m_sprintPause -= deltaTime;
-            if (m_sprintPause < 0.f)
-                m_sprintPause = 0.f;
+        m_staminaPercentage = CharacterMotionCore::StaminaPercentage(GetStaminaState(), GetStaminaParams());
+        // AZ_Printf("First Person Controller Component", "Stamina = %.10f\%", m_staminaPercentage);
+    }
 
-            if (m_sprintPause == 0.f && m_sprintCooldownTimer == 0.f && m_regenerateStaminaAutomatically && m_sprintHeldDuration > 0.f)
-            {
-                // Decrement the sprint held duration at a rate which makes it so that the stamina
-                // will regenerate when nearly depleted at the same time it would take if you were
-                // just wait through the cooldown time.
-                // Decrement this value by only deltaTime if you wish to instead use m_sprintPause
-                // to achieve the same timing but instead through the use of a pause.
-                m_sprintHeldDuration -= deltaTime * ((m_sprintMaxTime + m_sprintPauseTime) / m_sprintTotalCooldownTime) * m_sprintRegenRate;
-                m_staminaIncreasing = true;
-
-                if (m_sprintHeldDuration <= 0.f)
-                {
-                    m_sprintHeldDuration = 0.f;
-                    FirstPersonControllerComponentNotificationBus::Event(
-                        GetEntityId(), &FirstPersonControllerComponentNotifications::OnStaminaCapped);
-                }
-            }
-            else
-                m_staminaIncreasing = false;
+    CharacterMotionCore::StaminaParams FirstPersonControllerComponent::GetStaminaParams() const
+    {
+        CharacterMotionCore::StaminaParams params;
+        params.m_maxTime = m_sprintMaxTime;
+        params.m_pauseTime = m_sprintPauseTime;
+        params.m_totalCooldownTime = m_sprintTotalCooldownTime;
+        params.m_regenRate = m_sprintRegenRate;
+        params.m_usesStamina = m_sprintUsesStamina;
+        params.m_regenerateAutomatically = m_regenerateStaminaAutomatically;
+        return params;
+    }
 
-            if (m_sprintCooldownTimer != 0.f)
-            {
-                m_sprintCooldownTimer -= deltaTime;
-                if (m_sprintCooldownTimer <= 0.f)
-                {
-                    m_sprintCooldownTimer = 0.f;
-                    m_sprintPause = 0.f;
-                    FirstPersonControllerComponentNotificationBus::Event(
-                        GetEntityId(), &FirstPersonControllerComponentNotifications::OnCooldownDone);
-                    if (m_regenerateStaminaAutomatically)
-                    {
-                        m_sprintHeldDuration = 0.f;
-                        m_staminaIncreasing = true;
-                        FirstPersonControllerComponentNotificationBus::Event(
-                            GetEntityId(), &FirstPersonControllerComponentNotifications::OnStaminaCapped);
-                    }
-                }
-            }
-        }
+    CharacterMotionCore::StaminaState FirstPersonControllerComponent::GetStaminaState() const
+    {
+        CharacterMotionCore::StaminaState state;
+        state.m_heldDuration = m_sprintHeldDuration;
+        state.m_pause = m_sprintPause;
+        state.m_cooldownTimer = m_sprintCooldownTimer;
+        state.m_increasing = m_staminaIncreasing;
+        state.m_decreasing = m_staminaDecreasing;
+        return state;
+    }
 
-        if (m_sprintMaxTime != 0.f)
-            m_staminaPercentage = 100.f * (m_sprintMaxTime - m_sprintHeldDuration) / m_sprintMaxTime;
-        else
-            m_staminaPercentage = 0.f;
-        // AZ_Printf("First Person Controller Component", "Stamina = %.10f\%", m_staminaPercentage);
+    void FirstPersonControllerComponent::SetStaminaState(const CharacterMotionCore::StaminaState& state)
+    {
+        m_sprintHeldDuration = state.m_heldDuration;
+        m_sprintPause = state.m_pause;
+        m_sprintCooldownTimer = state.m_cooldownTimer;
+        m_staminaIncreasing = state.m_increasing;
+        m_staminaDecreasing = state.m_decreasing;
+    }
+
+    void FirstPersonControllerComponent::NotifyStaminaEvents(const AZ::u8 events)
+    {
+        if (events & CharacterMotionCore::StaminaEventReachedZero)
+            Notify(&FirstPersonControllerComponentNotifications::OnStaminaReachedZero);
+        if (events & CharacterMotionCore::StaminaEventCooldownStarted)
+            Notify(&FirstPersonControllerComponentNotifications::OnCooldownStarted);
+        if (events & CharacterMotionCore::StaminaEventCooldownDone)
+            Notify(&FirstPersonControllerComponentNotifications::OnCooldownDone);
+        if (events & CharacterMotionCore::StaminaEventCapped)
+            Notify(&FirstPersonControllerComponentNotifications::OnStaminaCapped);
     }
 
     void FirstPersonControllerComponent::CrouchManager(const float deltaTime)
     {
+        FPC_PROFILE_STAGE(CrouchManager);
+
         if (m_activeCameraEntity == nullptr)
             return;
 
-        AZ::TransformInterface* cameraTransform = m_activeCameraEntity->GetTransform();
+        CameraPoseCompositor* cameraPose = GetCameraPose();
 
         // Determine the latest sprint input value
         if (!m_sprintEnableToggle)
@@ -2741,8 +2948,7 @@ namespace FirstPersonController
             m_standing = false;
             m_crouched = false;
             if (AZ::IsClose(m_cameraLocalZTravelDistance, 0.f, 0.01f))
-                FirstPersonControllerComponentNotificationBus::Event(
-                    GetEntityId(), &FirstPersonControllerComponentNotifications::OnStartedCrouching);
+                Notify(&FirstPersonControllerComponentNotifications::OnStartedCrouching);
         }
 
         // Handle ongoing crouch down movement using PID control
@@ -2801,10 +3007,7 @@ namespace FirstPersonController
             PhysX::CharacterControllerRequestBus::Event(
                 GetEntityId(), &PhysX::CharacterControllerRequestBus::Events::Resize, m_capsuleCurrentHeight);
             if (!m_networkFPCEnabled || !m_isServer)
-            {
-                cameraTransform->SetLocalZ(m_eyeHeight + m_cameraLocalZTravelDistance);
-                m_cameraLocalZOverwritten = true;
-            }
+                cameraPose->SetLocalZ(m_eyeHeight + m_cameraLocalZTravelDistance);
 
             // Post-update error for settle check
             const float currentZError = targetLocalZOffset - m_cameraLocalZTravelDistance;
@@ -2826,8 +3029,7 @@ namespace FirstPersonController
                     m_crouched = true;
                     // Reset timer for next use
                     m_crouchDownSettleTimer = 0.f;
-                    FirstPersonControllerComponentNotificationBus::Event(
-                        GetEntityId(), &FirstPersonControllerComponentNotifications::OnCrouched);
+                    Notify(&FirstPersonControllerComponentNotifications::OnCrouched);
                 }
             }
             else
@@ -2853,8 +3055,7 @@ namespace FirstPersonController
             m_crouchingDownMove = false;
             m_crouched = false;
             if (AZ::IsClose(m_cameraLocalZTravelDistance, -m_crouchDistance, 0.01f))
-                FirstPersonControllerComponentNotificationBus::Event(
-                    GetEntityId(), &FirstPersonControllerComponentNotifications::OnStartedStanding);
+                Notify(&FirstPersonControllerComponentNotifications::OnStartedStanding);
         }
 
         if (m_standingUpMove)
@@ -2909,7 +3110,7 @@ namespace FirstPersonController
                 nullptr);
             request.m_reportMultipleHits = true;
             AzPhysics::SceneHandle sceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
-            AzPhysics::SceneQueryHits hits = sceneInterface->QueryScene(sceneHandle, &request);
+            AzPhysics::SceneQueryHits hits = QuerySceneReprocessingCached(sceneHandle, &request, ReprocessingQuery::Stand);
             auto selfChildEntityCheck = [this](AzPhysics::SceneQueryHit& hit)
             {
                 if (hit.m_entityId == GetEntityId())
@@ -2932,7 +3133,7 @@ namespace FirstPersonController
                 return false;
             };
 
-            AZStd::erase_if(hits.m_hits, selfChildEntityCheck);
+            FilterSceneQueryHits(hits, selfChildEntityCheck);
 
             m_standPreventedEntityIds.clear();
             if (hits)
@@ -2943,8 +3144,7 @@ namespace FirstPersonController
             if (hits || m_standPreventedViaScript)
             {
                 m_standPrevented = true;
-                FirstPersonControllerComponentNotificationBus::Event(
-                    GetEntityId(), &FirstPersonControllerComponentNotifications::OnStandPrevented);
+                Notify(&FirstPersonControllerComponentNotifications::OnStandPrevented);
                 // Stop on obstruction
                 m_currentCrouchVelocity = 0.f;
             }
@@ -2978,10 +3178,7 @@ namespace FirstPersonController
                 PhysX::CharacterControllerRequestBus::Event(
                     GetEntityId(), &PhysX::CharacterControllerRequestBus::Events::Resize, m_capsuleCurrentHeight);
                 if (!m_networkFPCEnabled || !m_isServer)
-                {
-                    cameraTransform->SetLocalZ(m_eyeHeight + m_cameraLocalZTravelDistance);
-                    m_cameraLocalZOverwritten = true;
-                }
+                    cameraPose->SetLocalZ(m_eyeHeight + m_cameraLocalZTravelDistance);
 
                 // Early standing for speed
                 const float postZError = TargetLocalZOffset - m_cameraLocalZTravelDistance;
@@ -3001,8 +3198,7 @@ namespace FirstPersonController
                         m_currentCrouchVelocity = 0.f;
                         m_standingUpMove = false;
                         m_standUpSettleTimer = 0.f;
-                        FirstPersonControllerComponentNotificationBus::Event(
-                            GetEntityId(), &FirstPersonControllerComponentNotifications::OnStoodUp);
+                        Notify(&FirstPersonControllerComponentNotifications::OnStoodUp);
                     }
                 }
                 else
@@ -3017,6 +3213,8 @@ namespace FirstPersonController
 
     void FirstPersonControllerComponent::UpdateVelocityXY(const float deltaTime)
     {
+        FPC_PROFILE_STAGE(UpdateVelocityXY);
+
         // So long as the character is grounded or depending on how the update X&Y velocity while jumping
         // boolean values are set, and based on the state of jumping/falling, update the X&Y velocity accordingly
         if (!(m_grounded || (m_updateXYAscending && m_updateXYDescending && !m_updateXYOnlyNearGround) ||
@@ -3196,6 +3394,8 @@ namespace FirstPersonController
     // Update m_velocityXCrossYDirection based on the sum of the normal vectors beneath the character
     void FirstPersonControllerComponent::AcquireSumOfGroundNormals()
     {
+        FPC_PROFILE_STAGE(AcquireSumOfGroundNormals);
+
         if (m_velocityXCrossYTracksNormal)
         {
             if (m_grounded || m_coyoteTime == 0.f || !m_coyoteTimeTracksLastNormal || m_applyGravityDuringCoyoteTime)
@@ -3217,6 +3417,8 @@ namespace FirstPersonController
 
     void FirstPersonControllerComponent::CheckCharacterMovementObstructed()
     {
+        FPC_PROFILE_STAGE(CheckCharacterMovementObstructed);
+
         // Get the current velocity to determine if something was hit
         if (!m_networkFPCEnabled)
             Physics::CharacterRequestBus::EventResult(m_currentVelocity, GetEntityId(), &Physics::CharacterRequestBus::Events::GetVelocity);
@@ -3250,8 +3452,7 @@ namespace FirstPersonController
                 if (m_gravityPrevented[0])
                 {
                     m_gravityPrevented[1] = true;
-                    FirstPersonControllerComponentNotificationBus::Event(
-                        GetEntityId(), &FirstPersonControllerComponentNotifications::OnCharacterGravityObstructed);
+                    Notify(&FirstPersonControllerComponentNotifications::OnCharacterGravityObstructed);
                 }
                 else
                     m_gravityPrevented[0] = true;
@@ -3259,8 +3460,7 @@ namespace FirstPersonController
             else
                 m_gravityPrevented[0] = m_gravityPrevented[1] = false;
 
-            FirstPersonControllerComponentNotificationBus::Event(
-                GetEntityId(), &FirstPersonControllerComponentNotifications::OnVelocityXYObstructed);
+            Notify(&FirstPersonControllerComponentNotifications::OnVelocityXYObstructed);
         }
         else
         {
@@ -3287,27 +3487,16 @@ namespace FirstPersonController
         }
     }
 
-    void FirstPersonControllerComponent::CheckGrounded(const float deltaTime)
+    void FirstPersonControllerComponent::GetGroundSphereCastPose(AZ::Transform& sphereCastPose, AZ::Vector3& sphereCastDirection) const
     {
-        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
-
-        if (!m_prevNTicksGrounded.empty())
-        {
-            // Shift the last grounded check through the prevNTickGrounded vector
-            AZStd::rotate(m_prevNTicksGrounded.rbegin(), m_prevNTicksGrounded.rbegin() + 1, m_prevNTicksGrounded.rend());
-            // Used to determine when event notifications occur
-            m_prevNTicksGrounded.front() = m_grounded;
-        }
-        const bool prevGroundClose = m_groundClose;
-
-        AZ::Transform sphereCastPose = AZ::Transform::CreateIdentity();
+        sphereCastPose = AZ::Transform::CreateIdentity();
 
         // Move the sphere to the location of the character and apply the Z offset
         sphereCastPose.SetTranslation(
             GetEntity()->GetTransform()->GetWorldTM().GetTranslation() +
             AZ::Vector3::CreateAxisZ((1.f + m_groundSphereCastsRadiusPercentageIncrease / 100.f) * m_capsuleRadius));
 
-        AZ::Vector3 sphereCastDirection = AZ::Vector3::CreateAxisZ(-1.f);
+        sphereCastDirection = AZ::Vector3::CreateAxisZ(-1.f);
 
         // Adjust the pose and direction of the sphere cast based on m_sphereCastsAxisDirectionPose
         if (m_sphereCastsAxisDirectionPose != AZ::Vector3::CreateAxisZ())
@@ -3326,35 +3515,51 @@ namespace FirstPersonController
                         .TransformVector(
                             -AZ::Vector3::CreateAxisZ((1.f + m_groundSphereCastsRadiusPercentageIncrease / 100.f) * m_capsuleRadius)));
         }
+    }
 
-        AzPhysics::ShapeCastRequest request;
-        if (!m_networkFPCEnabled)
-        {
-            request = AzPhysics::ShapeCastRequestHelpers::CreateSphereCastRequest(
-                m_capsuleRadius * (1.f + m_groundSphereCastsRadiusPercentageIncrease / 100.f),
-                sphereCastPose,
-                sphereCastDirection,
-                m_groundedSphereCastOffset,
-                AzPhysics::SceneQuery::QueryType::StaticAndDynamic,
-                m_groundedCollisionGroup,
-                nullptr);
-        }
-        else
+    AzPhysics::ShapeCastRequest FirstPersonControllerComponent::CreateGroundSphereCastRequest(
+        const float radius, const AZ::Transform& sphereCastPose, const AZ::Vector3& sphereCastDirection, const float distance) const
+    {
+        AzPhysics::ShapeCastRequest request = AzPhysics::ShapeCastRequestHelpers::CreateSphereCastRequest(
+            radius,
+            sphereCastPose,
+            sphereCastDirection,
+            distance,
+            AzPhysics::SceneQuery::QueryType::StaticAndDynamic,
+            m_groundedCollisionGroup,
+            nullptr);
+        request.m_reportMultipleHits = true;
+        return request;
+    }
+
+    void FirstPersonControllerComponent::CheckGrounded(const float deltaTime)
+    {
+        FPC_PROFILE_STAGE(CheckGrounded);
+
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        if (!m_prevNTicksGrounded.empty())
         {
-            request = AzPhysics::ShapeCastRequestHelpers::CreateSphereCastRequest(
-                m_capsuleRadius * (1.f + m_groundSphereCastsRadiusPercentageIncrease / 100.f),
-                sphereCastPose,
-                sphereCastDirection,
-                m_groundedSphereCastOffset + m_groundedExtraOffsetMultiplayerDynamic,
-                AzPhysics::SceneQuery::QueryType::StaticAndDynamic,
-                m_groundedCollisionGroup,
-                nullptr);
+            // Shift the last grounded check through the prevNTickGrounded vector
+            AZStd::rotate(m_prevNTicksGrounded.rbegin(), m_prevNTicksGrounded.rbegin() + 1, m_prevNTicksGrounded.rend());
+            // Used to determine when event notifications occur
+            m_prevNTicksGrounded.front() = m_grounded;
         }
+        const bool prevGroundClose = m_groundClose;
 
-        request.m_reportMultipleHits = true;
+        AZ::Transform sphereCastPose = AZ::Transform::CreateIdentity();
+        AZ::Vector3 sphereCastDirection = AZ::Vector3::CreateAxisZ(-1.f);
+        GetGroundSphereCastPose(sphereCastPose, sphereCastDirection);
+
+        const float groundSphereCastRadius = m_capsuleRadius * (1.f + m_groundSphereCastsRadiusPercentageIncrease / 100.f);
+        AzPhysics::ShapeCastRequest request = CreateGroundSphereCastRequest(
+            groundSphereCastRadius,
+            sphereCastPose,
+            sphereCastDirection,
+            m_networkFPCEnabled ? m_groundedSphereCastOffset + m_groundedExtraOffsetMultiplayerDynamic : m_groundedSphereCastOffset);
 
         AzPhysics::SceneHandle sceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
-        AzPhysics::SceneQueryHits hits = sceneInterface->QueryScene(sceneHandle, &request);
+        AzPhysics::SceneQueryHits hits = QueryGroundCached(sceneHandle, &request, ReprocessingQuery::Grounded, groundSphereCastRadius);
 
         AZStd::vector<AzPhysics::SceneQueryHit> steepNormals;
 
@@ -3419,7 +3624,7 @@ namespace FirstPersonController
         };
 
         m_groundHits.clear();
-        AZStd::erase_if(hits.m_hits, selfChildSlopeEntityCheck);
+        FilterSceneQueryHits(hits, selfChildSlopeEntityCheck);
         m_grounded = hits ? true : false;
 
         m_groundHitEntityIds.clear();
@@ -3472,24 +3677,15 @@ namespace FirstPersonController
         else
             m_airTime += deltaTime;
 
-        request = AzPhysics::ShapeCastRequestHelpers::CreateSphereCastRequest(
-            m_capsuleRadius * (1.f + m_groundSphereCastsRadiusPercentageIncrease / 100.f),
-            sphereCastPose,
-            sphereCastDirection,
-            m_groundCloseSphereCastOffset,
-            AzPhysics::SceneQuery::QueryType::StaticAndDynamic,
-            m_groundedCollisionGroup,
-            nullptr);
-
-        request.m_reportMultipleHits = true;
+        request = CreateGroundSphereCastRequest(groundSphereCastRadius, sphereCastPose, sphereCastDirection, m_groundCloseSphereCastOffset);
 
         // Filter the ground close hits
         groundedGroundCloseOrGroundCloseCoyoteTime = groundClose;
 
-        hits = sceneInterface->QueryScene(sceneHandle, &request);
+        hits = QueryGroundCached(sceneHandle, &request, ReprocessingQuery::GroundClose, groundSphereCastRadius);
 
         m_groundCloseHits.clear();
-        AZStd::erase_if(hits.m_hits, selfChildSlopeEntityCheck);
+        FilterSceneQueryHits(hits, selfChildSlopeEntityCheck);
         m_groundClose = hits ? true : false;
 
         if (m_scriptSetGroundCloseTick)
@@ -3504,17 +3700,13 @@ namespace FirstPersonController
         if (m_coyoteTime > 0.f)
         {
             // When the radius percentage increase is set to less than or equal to -100% then use a raycast instead
-            static constexpr float NoRadiusUseRacast = -100.f;
-            if (m_groundCloseCoyoteTimeRadiusPercentageIncrease > NoRadiusUseRacast)
+            if (m_groundCloseCoyoteTimeRadiusPercentageIncrease > NoRadiusUseRaycast)
             {
-                request = AzPhysics::ShapeCastRequestHelpers::CreateSphereCastRequest(
+                request = CreateGroundSphereCastRequest(
                     m_capsuleRadius * (1.f + m_groundCloseCoyoteTimeRadiusPercentageIncrease / 100.f),
                     sphereCastPose,
                     sphereCastDirection,
-                    m_groundCloseCoyoteTimeOffset,
-                    AzPhysics::SceneQuery::QueryType::StaticAndDynamic,
-                    m_groundedCollisionGroup,
-                    nullptr);
+                    m_groundCloseCoyoteTimeOffset);
             }
             else
             {
@@ -3526,6 +3718,7 @@ namespace FirstPersonController
                 rayRequest.m_collisionGroup = m_groundedCollisionGroup;
                 rayRequest.m_reportMultipleHits = true;
                 rayRequest.m_filterCallback = nullptr;
+                ++m_tickStats.m_sceneQueries;
                 hits = sceneInterface->QueryScene(sceneHandle, &rayRequest);
             }
 
@@ -3534,10 +3727,14 @@ namespace FirstPersonController
             // Filter the ground close coyote time hits
             groundedGroundCloseOrGroundCloseCoyoteTime = coyoteTimeGroundClose;
 
-            hits = sceneInterface->QueryScene(sceneHandle, &request);
+            hits = QueryGroundCached(
+                sceneHandle,
+                &request,
+                ReprocessingQuery::GroundCloseCoyoteTime,
+                m_capsuleRadius * (1.f + m_groundCloseCoyoteTimeRadiusPercentageIncrease / 100.f));
 
             m_groundCloseCoyoteTimeHits.clear();
-            AZStd::erase_if(hits.m_hits, selfChildSlopeEntityCheck);
+            FilterSceneQueryHits(hits, selfChildSlopeEntityCheck);
             m_groundCloseCoyoteTime = hits ? true : false;
 
             // AZ_Printf("First Person Controller Component", "m_groundCloseCoyoteTime = %s", m_groundCloseCoyoteTime ? "true" : "false");
@@ -3558,11 +3755,10 @@ namespace FirstPersonController
                     GetEntity()->GetTransform()->GetWorldTM().GetTranslation().GetProjected(m_velocityZPosDirection).GetLength() -
                     m_fellFromHeight;
             const float fellVelocity = m_sphereCastsAxisDirectionPose.Dot(m_prevTargetVelocity);
-            FirstPersonControllerComponentNotificationBus::Event(
-                GetEntityId(), &FirstPersonControllerComponentNotifications::OnGroundHit, fellVelocity);
+            Notify(&FirstPersonControllerComponentNotifications::OnGroundHit, fellVelocity);
         }
         else if (m_prevNTicksGrounded.front() && !m_grounded)
-            FirstPersonControllerComponentNotificationBus::Event(GetEntityId(), &FirstPersonControllerComponentNotifications::OnUngrounded);
+            Notify(&FirstPersonControllerComponentNotifications::OnUngrounded);
 
         if (!prevGroundClose && m_groundClose)
         {
@@ -3574,36 +3770,50 @@ namespace FirstPersonController
                     m_fellFromHeight;
             const float soonFellVelocity = m_sphereCastsAxisDirectionPose.Dot(m_prevTargetVelocity);
             m_onGroundSoonHit = true;
-            FirstPersonControllerComponentNotificationBus::Event(
-                GetEntityId(), &FirstPersonControllerComponentNotifications::OnGroundSoonHit, soonFellVelocity);
+            Notify(&FirstPersonControllerComponentNotifications::OnGroundSoonHit, soonFellVelocity);
         }
     }
 
     void FirstPersonControllerComponent::UpdateJumpMaxHoldTime()
     {
-        // Calculate the amount of time that the jump key can be held based on m_jumpHoldDistance
-        // divided by the average of the initial jump velocity and the velocity at the transition point
-        const float jumpVelocityHoldDistanceSquared =
-            m_jumpInitialVelocity * m_jumpInitialVelocity + 2.f * m_gravity * m_jumpHeldGravityFactor * m_jumpHoldDistance;
-        // If the initial velocity is large enough such that the apogee can be reached outside of the jump hold distance
-        // then compute how long the jump key is held while still inside the jump hold distance
-        if (jumpVelocityHoldDistanceSquared >= 0.f)
-            m_jumpMaxHoldTime = m_jumpHoldDistance / ((m_jumpInitialVelocity + sqrt(jumpVelocityHoldDistanceSquared)) / 2.f);
-        // Otherwise the apogee will be reached inside m_jumpHoldDistance
-        // and the jump time needs to computed accordingly
-        else
-        {
-            AZ_Warning("First Person Controller Component", false, "Jump Hold Distance is higher than the max apogee of the jump.")
-                m_jumpMaxHoldTime = abs(m_jumpInitialVelocity / (m_gravity * m_jumpHeldGravityFactor));
-        }
+        bool apogeeInHoldDistance = false;
+        m_jumpMaxHoldTime = CharacterMotionCore::JumpMaxHoldTime(
+            m_jumpInitialVelocity, m_gravity * m_jumpHeldGravityFactor, m_jumpHoldDistance, apogeeInHoldDistance);
+        AZ_Warning(
+            "First Person Controller Component", !apogeeInHoldDistance, "Jump Hold Distance is higher than the max apogee of the jump.");
     }
 
-    void FirstPersonControllerComponent::UpdateVelocityZ(const float deltaTime)
+    void FirstPersonControllerComponent::CheckHeadHit()
     {
-        // Create a shapecast sphere that will be used to detect whether there is an obstruction
-        // above the players head, and prevent them from fully standing up if there is
+        CastHeadHit();
+
+        if (m_headHit && !m_grounded && m_applyVelocityZ >= 0.f)
+            Notify(&FirstPersonControllerComponentNotifications::OnHeadHit);
+    }
+
+    void FirstPersonControllerComponent::CastHeadHit()
+    {
+        AzPhysics::ShapeCastRequest request = CreateHeadHitRequest();
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        AzPhysics::SceneHandle sceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
+        AzPhysics::SceneQueryHits hits = QuerySceneReprocessingCached(sceneHandle, &request, ReprocessingQuery::Head);
+        SetHeadHitFromHits(hits);
+    }
+
+    void FirstPersonControllerComponent::CastSkippedHeadHit() const
+    {
+        // Outside of the tick there is no input being reprocessed, so the scene is queried directly
+        const AzPhysics::ShapeCastRequest request = CreateHeadHitRequest();
         auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        AzPhysics::SceneHandle sceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
+        AzPhysics::SceneQueryHits hits = sceneInterface->QueryScene(sceneHandle, &request);
+        SetHeadHitFromHits(hits);
+    }
 
+    AzPhysics::ShapeCastRequest FirstPersonControllerComponent::CreateHeadHitRequest() const
+    {
+        // Create a shapecast sphere that will be used to detect whether there is an obstruction
+        // above the players head, and prevent them from fully standing up if there is
         AZ::Transform sphereCastPose = AZ::Transform::CreateIdentity();
 
         // Move the sphere to the location of the character and apply the Z offset
@@ -3640,8 +3850,12 @@ namespace FirstPersonController
 
         request.m_reportMultipleHits = true;
 
-        AzPhysics::SceneHandle sceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
-        AzPhysics::SceneQueryHits hits = sceneInterface->QueryScene(sceneHandle, &request);
+        return request;
+    }
+
+    void FirstPersonControllerComponent::SetHeadHitFromHits(AzPhysics::SceneQueryHits& hits) const
+    {
+        m_headHitCastSkipped = false;
 
         // Disregard intersections with the character's collider and its child entities
         auto selfChildEntityCheck = [this](AzPhysics::SceneQueryHit& hit)
@@ -3652,7 +3866,7 @@ namespace FirstPersonController
             // Obtain the child IDs if we don't already have them
             if (!m_obtainedChildIds)
             {
-                ReacquireChildEntityIds();
+                AZ::TransformBus::EventResult(m_children, GetEntityId(), &AZ::TransformBus::Events::GetChildren);
                 m_obtainedChildIds = true;
             }
 
@@ -3677,7 +3891,7 @@ namespace FirstPersonController
             return false;
         };
 
-        AZStd::erase_if(hits.m_hits, selfChildEntityCheck);
+        FilterSceneQueryHits(hits, selfChildEntityCheck);
 
         m_headHit = hits ? true : false;
 
@@ -3685,9 +3899,20 @@ namespace FirstPersonController
         if (m_headHit)
             for (AzPhysics::SceneQueryHit hit : hits.m_hits)
                 m_headHitEntityIds.push_back(hit.m_entityId);
+    }
 
-        if (m_headHit && !m_grounded && m_applyVelocityZ >= 0.f)
-            FirstPersonControllerComponentNotificationBus::Event(GetEntityId(), &FirstPersonControllerComponentNotifications::OnHeadHit);
+    void FirstPersonControllerComponent::UpdateVelocityZ(const float deltaTime)
+    {
+        FPC_PROFILE_STAGE(UpdateVelocityZ);
+
+        // The head cast only matters while ascending, while hanging at the top of a jump or in coyote time, or when a jump may start
+        // this tick, so walking and falling characters skip it until the head hit is asked for
+        const bool headHitMatters = m_applyVelocityZ > 0.f || (!m_grounded && m_applyVelocityZ >= 0.f) || m_jumpValue != 0.f ||
+            m_scriptJump || m_crouchJumpPending || m_jumpCoyoteGravityPending || (m_gravityPrevented[0] && m_gravityPrevented[1]);
+        if (headHitMatters)
+            CheckHeadHit();
+        else
+            m_headHitCastSkipped = true;
 
         if (m_gravityPrevented[0] && m_gravityPrevented[1])
         {
@@ -3702,6 +3927,8 @@ namespace FirstPersonController
 
         const float prevApplyVelocityZ = m_applyVelocityZ;
 
+        const CharacterMotionCore::GravityParams gravityParams{ m_gravity, m_jumpHeldGravityFactor, m_jumpFallingGravityFactor };
+
         bool initialJump = false;
 
         // Used in First Person Extras and NetworkFPC
@@ -3724,8 +3951,7 @@ namespace FirstPersonController
                         m_crouching = false;
                         if (m_crouchPendJumps && m_crouchEnableToggle && !m_crouchJumpPending)
                         {
-                            FirstPersonControllerComponentNotificationBus::Event(
-                                GetEntityId(), &FirstPersonControllerComponentNotifications::OnStoodUpFromJump);
+                            Notify(&FirstPersonControllerComponentNotifications::OnStoodUpFromJump);
                             m_crouchJumpPending = true;
                         }
                     }
@@ -3743,8 +3969,7 @@ namespace FirstPersonController
                     m_jumpCoyoteGravityPending = false;
                 }
                 m_onFirstJump = true;
-                FirstPersonControllerComponentNotificationBus::Event(
-                    GetEntityId(), &FirstPersonControllerComponentNotifications::OnFirstJump);
+                Notify(&FirstPersonControllerComponentNotifications::OnFirstJump);
             }
             else
             {
@@ -3769,12 +3994,14 @@ namespace FirstPersonController
             {
                 m_jumpHeld = false;
                 m_jumpTimer = 0.f;
-                m_applyVelocityZCurrentDelta = m_gravity * deltaTime;
+                m_applyVelocityZCurrentDelta =
+                    CharacterMotionCore::GravityDeltaZ(gravityParams, CharacterMotionCore::GravityPhase::Free, deltaTime);
             }
             else
             {
                 m_jumpTimer += deltaTime;
-                m_applyVelocityZCurrentDelta = m_gravity * m_jumpHeldGravityFactor * deltaTime;
+                m_applyVelocityZCurrentDelta =
+                    CharacterMotionCore::GravityDeltaZ(gravityParams, CharacterMotionCore::GravityPhase::JumpHeld, deltaTime);
             }
         }
         else
@@ -3811,10 +4038,10 @@ namespace FirstPersonController
                     m_jumpTimer = m_jumpMaxHoldTime;
             }
 
-            if (m_applyVelocityZ <= 0.f)
-                m_applyVelocityZCurrentDelta = m_gravity * m_jumpFallingGravityFactor * deltaTime;
-            else
-                m_applyVelocityZCurrentDelta = m_gravity * deltaTime;
+            m_applyVelocityZCurrentDelta = CharacterMotionCore::GravityDeltaZ(
+                gravityParams,
+                m_applyVelocityZ <= 0.f ? CharacterMotionCore::GravityPhase::Falling : CharacterMotionCore::GravityPhase::Free,
+                deltaTime);
 
             if (m_jumpHeld && m_jumpValue == 0.f)
                 m_jumpHeld = false;
@@ -3832,8 +4059,7 @@ namespace FirstPersonController
                 m_applyVelocityZCurrentDelta = -m_gravity * deltaTime;
                 m_onFinalJump = true;
                 m_jumpHeld = true;
-                FirstPersonControllerComponentNotificationBus::Event(
-                    GetEntityId(), &FirstPersonControllerComponentNotifications::OnFinalJump);
+                Notify(&FirstPersonControllerComponentNotifications::OnFinalJump);
             }
 
             if (m_airTime < m_coyoteTime && !m_ungroundedDueToJump && m_applyGravityDuringCoyoteTime && m_jumpValue)
@@ -3845,8 +4071,9 @@ namespace FirstPersonController
             m_applyVelocityZ += m_applyVelocityZCurrentDelta;
         else
         {
-            m_applyVelocityZ = m_jumpInitialVelocity + m_gravity * m_jumpHeldGravityFactor * deltaTime;
-            m_applyVelocityZCurrentDelta = m_gravity * m_jumpHeldGravityFactor * deltaTime;
+            m_applyVelocityZCurrentDelta =
+                CharacterMotionCore::GravityDeltaZ(gravityParams, CharacterMotionCore::GravityPhase::JumpHeld, deltaTime);
+            m_applyVelocityZ = m_jumpInitialVelocity + m_applyVelocityZCurrentDelta;
         }
 
         if (m_headHit && m_applyVelocityZ > 0.f && m_headHitSetsApogee)
@@ -3880,10 +4107,8 @@ namespace FirstPersonController
             else
                 m_fellFromHeight =
                     GetEntity()->GetTransform()->GetWorldTM().GetTranslation().GetProjected(m_velocityZPosDirection).GetLength();
-            FirstPersonControllerComponentNotificationBus::Event(
-                GetEntityId(), &FirstPersonControllerComponentNotifications::OnJumpApogeeReached);
-            FirstPersonControllerComponentNotificationBus::Event(
-                GetEntityId(), &FirstPersonControllerComponentNotifications::OnStartedFalling);
+            Notify(&FirstPersonControllerComponentNotifications::OnJumpApogeeReached);
+            Notify(&FirstPersonControllerComponentNotifications::OnStartedFalling);
         }
         else if (prevApplyVelocityZ == 0.f && m_applyVelocityZ < 0.f)
         {
@@ -3892,8 +4117,7 @@ namespace FirstPersonController
             else
                 m_fellFromHeight =
                     GetEntity()->GetTransform()->GetWorldTM().GetTranslation().GetProjected(m_velocityZPosDirection).GetLength();
-            FirstPersonControllerComponentNotificationBus::Event(
-                GetEntityId(), &FirstPersonControllerComponentNotifications::OnStartedFalling);
+            Notify(&FirstPersonControllerComponentNotifications::OnStartedFalling);
         }
 
         // Debug print statements to observe the jump mechanic
@@ -3912,83 +4136,46 @@ namespace FirstPersonController
 
     void FirstPersonControllerComponent::ProcessLinearImpulse(const float deltaTime)
     {
-        // Only apply impulses if it's enabled, allow any residual velocity from a previous impulse to decay
-        if (!m_enableImpulses)
-        {
-            m_linearImpulse = AZ::Vector3::CreateZero();
-            if (m_velocityFromImpulse.IsZero())
-                return;
-        }
-
-        if (m_impulseDecelUsesFriction && !m_groundHits.empty())
-            m_impulseConstantDecel = -1.f * m_gravity * GetSceneQueryHitDynamicFriction(m_groundHits.front());
-        else if (m_groundHits.empty())
-            m_impulseConstantDecel = 0.f;
-
-        // Convert the linear impulse to a velocity based on the character's mass and accumulate it
-        const AZ::Vector3 impulseVelocity = m_linearImpulse / m_characterMass;
-        m_velocityFromImpulse += impulseVelocity;
-
-        // When using a constant deceleration, calculate a new total lerp time when an impulse is applied or when the deceleration changes
-        if (!impulseVelocity.IsZero() || m_impulsePrevConstantDecel != m_impulseConstantDecel)
-        {
-            m_initVelocityFromImpulse = m_velocityFromImpulse;
-            m_impulseTotalLerpTime = m_initVelocityFromImpulse.GetLength() / m_impulseConstantDecel;
-            m_impulseLerpTime = 0.f;
-            m_impulsePrevConstantDecel = m_impulseConstantDecel;
-        }
-
-        // Decelerate using the linear damping value
-        if (m_impulseLinearDamp != 0.f)
-        {
-            // This follows a first-order homogeneous linear recurrence relation, similar to Stokes' Law
-            m_velocityFromImpulse *= (1 - m_impulseLinearDamp * deltaTime);
-            if (m_impulseConstantDecel != 0.f)
-            {
-                m_initVelocityFromImpulse = m_velocityFromImpulse;
-                m_impulseTotalLerpTime = m_initVelocityFromImpulse.GetLength() / m_impulseConstantDecel;
-                m_impulseLerpTime = 0.f;
-                m_impulsePrevConstantDecel = m_impulseConstantDecel;
-            }
-        }
-
-        // Apply the velocity from the impulse
-        m_applyVelocityXYFromImpulse = AZ::Vector2(m_velocityFromImpulse);
-        m_applyVelocityZ += m_velocityFromImpulse.GetZ();
-
-        // Accumulate the deltaTime
-        m_impulseLerpTime += deltaTime;
-
-        // Decelerate at a constant rate
-        // If the total lerp time is zero or the lerp time has reached the total lerp time then do not continue adding velocity
-        if (m_impulseConstantDecel != 0.f && (m_impulseTotalLerpTime == 0.f || m_impulseLerpTime >= m_impulseTotalLerpTime))
-        {
-            m_impulseLerpTime = m_impulseTotalLerpTime;
-            m_initVelocityFromImpulse = AZ::Vector3::CreateZero();
-            m_velocityFromImpulse = AZ::Vector3::CreateZero();
-            m_linearImpulse = AZ::Vector3::CreateZero();
-            return;
-        }
-        // Set the applied velocity based on the time that was calculated for it to reach zero
-        else if (m_impulseConstantDecel != 0.f)
-            m_velocityFromImpulse = m_initVelocityFromImpulse.Lerp(AZ::Vector3::CreateZero(), m_impulseLerpTime / m_impulseTotalLerpTime);
-
-        // Debug print statements to observe the acceleration and timing
-        // static AZ::Vector3 prevVelocity = m_velocityFromImpulse;
-        // AZ_Printf("First Person Controller Component", "dv/dt = %.10f", prevVelocity.GetDistance(m_velocityFromImpulse)/deltaTime);
-        // prevVelocity = m_velocityFromImpulse;
-        // AZ_Printf("First Person Controller Component", "m_impulseTotalLerpTime = %.10f", m_impulseTotalLerpTime);
-        // AZ_Printf("First Person Controller Component", "m_impulseLerpTime = %.10f", m_impulseLerpTime);
-
-        // Set the Z component of the velocity from the impulse to zero after it's applied
-        m_velocityFromImpulse.SetZ(0.f);
-
-        // Zero the impulse vector since it's been applied for this update
-        m_linearImpulse = AZ::Vector3::CreateZero();
+        FPC_PROFILE_STAGE(ProcessLinearImpulse);
+
+        CharacterMotionCore::ImpulseParams params;
+        params.m_characterMass = m_characterMass;
+        params.m_gravity = m_gravity;
+        params.m_linearDamp = m_impulseLinearDamp;
+        params.m_enableImpulses = m_enableImpulses;
+        params.m_decelUsesFriction = m_impulseDecelUsesFriction;
+
+        CharacterMotionCore::ImpulseState state;
+        state.m_linearImpulse = m_linearImpulse;
+        state.m_velocityFromImpulse = m_velocityFromImpulse;
+        state.m_initVelocityFromImpulse = m_initVelocityFromImpulse;
+        state.m_constantDecel = m_impulseConstantDecel;
+        state.m_prevConstantDecel = m_impulsePrevConstantDecel;
+        state.m_totalLerpTime = m_impulseTotalLerpTime;
+        state.m_lerpTime = m_impulseLerpTime;
+
+        CharacterMotionCore::QueryResults queryResults;
+        queryResults.m_grounded = m_grounded;
+        queryResults.m_groundHit = !m_groundHits.empty();
+        // The friction is only looked up when there is an impulse velocity for it to act on
+        if (m_impulseDecelUsesFriction && queryResults.m_groundHit && (m_enableImpulses || !m_velocityFromImpulse.IsZero()))
+            queryResults.m_groundDynamicFriction = GetSceneQueryHitDynamicFriction(m_groundHits.front());
+
+        CharacterMotionCore::DecayLinearImpulse(state, params, queryResults, deltaTime, m_applyVelocityXYFromImpulse, m_applyVelocityZ);
+
+        m_linearImpulse = state.m_linearImpulse;
+        m_velocityFromImpulse = state.m_velocityFromImpulse;
+        m_initVelocityFromImpulse = state.m_initVelocityFromImpulse;
+        m_impulseConstantDecel = state.m_constantDecel;
+        m_impulsePrevConstantDecel = state.m_prevConstantDecel;
+        m_impulseTotalLerpTime = state.m_totalLerpTime;
+        m_impulseLerpTime = state.m_lerpTime;
     }
 
     void FirstPersonControllerComponent::ProcessCharacterHits(const float deltaTime)
     {
+        FPC_PROFILE_STAGE(ProcessCharacterHits);
+
         if (!m_enableCharacterHits)
             return;
 
@@ -4006,9 +4193,27 @@ namespace FirstPersonController
         // Set the translation and shift the capsule based on the character's capsule height
         capsulePose.SetTranslation(m_prevTranslation + m_sphereCastsAxisDirectionPose * (m_capsuleCurrentHeight / 2.f));
 
-        m_prevTranslation = GetEntity()->GetTransform()->GetWorldTM().GetTranslation();
+        const AZ::Vector3 translation = GetEntity()->GetTransform()->GetWorldTM().GetTranslation();
+        const bool moved = !translation.IsClose(m_prevTranslation);
+        m_prevTranslation = translation;
+
+        const bool moving = !m_applyVelocityXY.IsZero() || m_applyVelocityZ != 0.f || !m_currentVelocity.IsZero();
+
+        AzPhysics::SceneHandle sceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
 
-        AzPhysics::ShapeCastRequest request = !m_applyVelocityXY.IsZero() || m_applyVelocityZ != 0.f || !m_currentVelocity.IsZero()
+        // Hits on static bodies which still exist can't change while the character stays put, so adaptive hit detection keeps them
+        // and only sweeps every m_characterHitsIdleSweepInterval ticks. A hit on anything else is swept for again every tick.
+        const bool keepHits =
+            m_characterHitsAdaptive && !moving && !moved && GetSceneQueryHitsStatic(sceneHandle, m_characterHits);
+        if (keepHits && ++m_characterHitsIdleTickCount < m_characterHitsIdleSweepInterval)
+        {
+            if (!m_characterHits.empty())
+                Notify(&FirstPersonControllerComponentNotifications::OnCharacterShapecastHitSomething, m_characterHits);
+            return;
+        }
+        m_characterHitsIdleTickCount = moving ? m_characterHitsIdleSweepInterval : 0;
+
+        AzPhysics::ShapeCastRequest request = moving
             ? AzPhysics::ShapeCastRequestHelpers::CreateCapsuleCastRequest(
                   m_capsuleRadius * (1.f + m_hitRadiusPercentageIncrease / 100.f),
                   m_capsuleCurrentHeight * (1.f + m_hitHeightPercentageIncrease / 100.f),
@@ -4032,7 +4237,21 @@ namespace FirstPersonController
 
         request.m_reportMultipleHits = true;
 
-        AzPhysics::SceneHandle sceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
+        // With nothing besides the kept hits inside the shapecast's bounding box, the shapecast would find just the kept hits, so it's
+        // skipped
+        if (m_characterHitsAdaptive && !GetCharacterHitCandidateNear(sceneHandle, request, keepHits))
+        {
+            if (!keepHits)
+            {
+                m_characterHitEntityIds.clear();
+                m_characterHits.clear();
+            }
+            if (!m_characterHits.empty())
+                Notify(&FirstPersonControllerComponentNotifications::OnCharacterShapecastHitSomething, m_characterHits);
+            return;
+        }
+
+        ++m_tickStats.m_sceneQueries;
         AzPhysics::SceneQueryHits hits = sceneInterface->QueryScene(sceneHandle, &request);
 
         // Disregard intersections with the character's collider and its child entities
@@ -4057,7 +4276,7 @@ namespace FirstPersonController
             return false;
         };
 
-        AZStd::erase_if(hits.m_hits, selfChildEntityCheck);
+        FilterSceneQueryHits(hits, selfChildEntityCheck);
         m_characterHitEntityIds.clear();
         for (AzPhysics::SceneQueryHit hit : hits.m_hits)
             m_characterHitEntityIds.push_back(hit.m_entityId);
@@ -4065,8 +4284,72 @@ namespace FirstPersonController
         m_characterHits = hits.m_hits;
 
         if (!m_characterHits.empty())
-            FirstPersonControllerComponentNotificationBus::Event(
-                GetEntityId(), &FirstPersonControllerComponentNotifications::OnCharacterShapecastHitSomething, m_characterHits);
+            Notify(&FirstPersonControllerComponentNotifications::OnCharacterShapecastHitSomething, m_characterHits);
+    }
+
+    bool FirstPersonControllerComponent::GetCharacterHitCandidateNear(
+        AzPhysics::SceneHandle sceneHandle, const AzPhysics::ShapeCastRequest& request, const bool excludeKeptHits)
+    {
+        const auto* capsule = azrtti_cast<const Physics::CapsuleShapeConfiguration*>(request.m_shapeConfiguration.get());
+        if (capsule == nullptr)
+            return true;
+
+        auto keptHit = [this, excludeKeptHits](const AzPhysics::SimulatedBodyHandle bodyHandle)
+        {
+            return excludeKeptHits &&
+                AZStd::find_if(
+                    m_characterHits.begin(),
+                    m_characterHits.end(),
+                    [bodyHandle](const AzPhysics::SceneQueryHit& hit)
+                    {
+                        return hit.m_bodyHandle == bodyHandle;
+                    }) != m_characterHits.end();
+        };
+
+        // The ground beneath the character is always inside the box, so when the shapecast can hit ground that isn't already one of
+        // the kept hits the overlap is not run
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        for (const AzPhysics::SceneQueryHit& hit : m_groundHits)
+        {
+            if (hit.m_shape == nullptr || !request.m_collisionGroup.IsSet(hit.m_shape->GetCollisionLayer()) || keptHit(hit.m_bodyHandle))
+                continue;
+            if (request.m_queryType == AzPhysics::SceneQuery::QueryType::StaticAndDynamic)
+                return true;
+            const bool groundStatic =
+                azrtti_cast<AzPhysics::StaticRigidBody*>(sceneInterface->GetSimulatedBodyFromHandle(sceneHandle, hit.m_bodyHandle)) !=
+                nullptr;
+            if (groundStatic == (request.m_queryType == AzPhysics::SceneQuery::QueryType::Static))
+                return true;
+        }
+
+        // Axis-aligned box around the capsule at both ends of the sweep
+        const AZ::Vector3 capsuleAxis = request.m_start.GetRotation().TransformVector(AZ::Vector3::CreateAxisZ());
+        const AZ::Vector3 capsuleHalfExtents =
+            capsuleAxis.GetAbs() * AZ::GetMax(capsule->m_height / 2.f - capsule->m_radius, 0.f) + AZ::Vector3(capsule->m_radius);
+        const AZ::Vector3 sweep = request.m_direction.GetNormalizedSafe() * request.m_distance;
+
+        AZ::Transform boxPose = AZ::Transform::CreateTranslation(request.m_start.GetTranslation() + sweep / 2.f);
+        AzPhysics::OverlapRequest overlapRequest = AzPhysics::OverlapRequestHelpers::CreateBoxOverlapRequest(
+            (capsuleHalfExtents + sweep.GetAbs() / 2.f) * 2.f,
+            boxPose,
+            [this, &keptHit](const AzPhysics::SimulatedBody* body, [[maybe_unused]] const Physics::Shape* shape)
+            {
+                if (body == nullptr || body->GetEntityId() == GetEntityId() || keptHit(body->m_bodyHandle))
+                    return false;
+                return AZStd::find(m_children.begin(), m_children.end(), body->GetEntityId()) == m_children.end();
+            });
+        overlapRequest.m_queryType = request.m_queryType;
+        overlapRequest.m_collisionGroup = request.m_collisionGroup;
+
+        // Obtain the child IDs if we don't already have them
+        if (!m_obtainedChildIds)
+        {
+            ReacquireChildEntityIds();
+            m_obtainedChildIds = true;
+        }
+
+        ++m_tickStats.m_sceneQueries;
+        return sceneInterface->QueryScene(sceneHandle, &overlapRequest) ? true : false;
     }
 
     // TiltVectorXCrossY will rotate any vector2 such that the cross product of its components becomes aligned
@@ -4087,16 +4370,13 @@ namespace FirstPersonController
 
     void FirstPersonControllerComponent::GetNetworkFPCProperties()
     {
+        FPC_PROFILE_STAGE(GetNetworkFPCProperties);
+
         if (m_networkFPCControllerObject != nullptr)
         {
 #ifdef NETWORKFPC
             if (m_isServer || m_isHost)
-            {
-                if (m_networkFPCControllerObject->GetPlayerStringNetEntityIds() != m_playerStringNetEntityIds)
-                    m_networkFPCControllerObject->SetPlayerStringNetEntityIds(m_playerStringNetEntityIds);
-                if (m_networkFPCControllerObject->GetBotStringNetEntityIds() != m_botStringNetEntityIds)
-                    m_networkFPCControllerObject->SetBotStringNetEntityIds(m_botStringNetEntityIds);
-            }
+                SetPlayerBotStringNetEntityIdsProperties();
             else
             {
                 m_playerStringNetEntityIds = m_networkFPCControllerObject->GetPlayerStringNetEntityIds();
@@ -4138,6 +4418,8 @@ namespace FirstPersonController
 
     void FirstPersonControllerComponent::SetNetworkFPCProperties() const
     {
+        FPC_PROFILE_STAGE(SetNetworkFPCProperties);
+
 #ifdef NETWORKFPC
         if (m_networkFPCControllerObject != nullptr)
         {
@@ -4145,10 +4427,10 @@ namespace FirstPersonController
             {
                 m_networkFPCControllerObject->SetIsSprinting(GetSprinting());
                 m_networkFPCControllerObject->SetCorrectedVelocityXY(m_correctedVelocityXY);
-                m_networkFPCControllerObject->SetIsSprintingRelay(GetSprinting());
-                m_networkFPCControllerObject->SetCorrectedVelocityXYRelay(m_correctedVelocityXY);
             }
-            else
+            // The relay properties are only read by non-autonomous clients, so the server and a listen server host's own
+            // character send them at a reduced rate when no other player is near (see the NetworkFPC Relevance archetype properties)
+            if ((m_isServer || m_isHost) && m_networkFPCControllerObject->m_relayPropertiesDue)
             {
                 m_networkFPCControllerObject->SetIsSprintingRelay(m_networkFPCControllerObject->GetIsSprinting());
                 m_networkFPCControllerObject->SetCorrectedVelocityXYRelay(m_networkFPCControllerObject->GetCorrectedVelocityXY());
@@ -4171,16 +4453,7 @@ namespace FirstPersonController
             m_networkFPCControllerObject->SetApplyVelocityXY(m_applyVelocityXY);
             m_networkFPCControllerObject->SetApplyVelocityZ(m_applyVelocityZ);
             if (m_isServer || m_isHost)
-            {
-                if (m_reacquirePlayerBotStringNetEntityIds)
-                {
-                    GetPlayerStringNetEntityIdsOnServer();
-                    GetBotStringNetEntityIdsOnServer();
-                    m_reacquirePlayerBotStringNetEntityIds = false;
-                }
-                m_networkFPCControllerObject->SetPlayerStringNetEntityIds(m_playerStringNetEntityIds);
-                m_networkFPCControllerObject->SetBotStringNetEntityIds(m_botStringNetEntityIds);
-            }
+                SetPlayerBotStringNetEntityIdsProperties();
         }
         else if (m_networkFPCBotAnimationControllerObject != nullptr)
         {
@@ -4196,9 +4469,340 @@ namespace FirstPersonController
 #endif
     }
 
+    AzPhysics::SceneQueryHits FirstPersonControllerComponent::QuerySceneReprocessingCached(
+        AzPhysics::SceneHandle sceneHandle, AzPhysics::ShapeCastRequest* request, ReprocessingQuery query)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        if (!GetReprocessingQueryCacheInUse())
+        {
+            ++m_tickStats.m_sceneQueries;
+            return sceneInterface->QueryScene(sceneHandle, request);
+        }
+
+        const AZStd::array<AZ::s32, 4> poseBucket = GetReprocessingQueryPoseBucket(*request);
+        const ReprocessingQueryCacheEntry& entry = GetReprocessingQueryCacheEntry(query);
+
+        if (m_reprocessingInput && entry.m_valid && entry.m_clientInputId == m_reprocessingClientInputId &&
+            entry.m_poseBucket == poseBucket)
+            return entry.m_hits;
+
+        ++m_tickStats.m_sceneQueries;
+        AzPhysics::SceneQueryHits hits = sceneInterface->QueryScene(sceneHandle, request);
+        RecordReprocessingQuery(sceneHandle, query, poseBucket, hits);
+        return hits;
+    }
+
+    bool FirstPersonControllerComponent::GetReprocessingQueryCacheInUse() const
+    {
+        return m_reprocessingQueryCacheActive && !m_reprocessingQueryCache.empty() && m_reprocessingQueryPoseBucket > 0.f;
+    }
+
+    AZStd::array<AZ::s32, 4> FirstPersonControllerComponent::GetReprocessingQueryPoseBucket(
+        const AzPhysics::ShapeCastRequest& request) const
+    {
+        const AZ::Vector3 bucket = (request.m_start.GetTranslation() / m_reprocessingQueryPoseBucket).GetRound();
+        const float distanceBucket = AZStd::round(request.m_distance / m_reprocessingQueryPoseBucket);
+        return { static_cast<AZ::s32>(bucket.GetX()),
+                 static_cast<AZ::s32>(bucket.GetY()),
+                 static_cast<AZ::s32>(bucket.GetZ()),
+                 static_cast<AZ::s32>(distanceBucket) };
+    }
+
+    FirstPersonControllerComponent::ReprocessingQueryCacheEntry& FirstPersonControllerComponent::GetReprocessingQueryCacheEntry(
+        const ReprocessingQuery query)
+    {
+        return m_reprocessingQueryCache
+            [(m_reprocessingClientInputId % ReprocessingQueryCacheInputWindow) * ReprocessingQueryCount + static_cast<size_t>(query)];
+    }
+
+    void FirstPersonControllerComponent::RecordReprocessingQuery(
+        AzPhysics::SceneHandle sceneHandle,
+        const ReprocessingQuery query,
+        const AZStd::array<AZ::s32, 4>& poseBucket,
+        const AzPhysics::SceneQueryHits& hits)
+    {
+        // Only results made up entirely of static bodies, or of this character and its children, can be reused. The slot's hits
+        // vector keeps its capacity, so recording doesn't allocate once the ring has warmed up
+        ReprocessingQueryCacheEntry& entry = GetReprocessingQueryCacheEntry(query);
+        entry.m_valid = GetSceneQueryHitsStatic(sceneHandle, hits.m_hits);
+        if (entry.m_valid)
+        {
+            entry.m_hits.m_hits.assign(hits.m_hits.begin(), hits.m_hits.end());
+            entry.m_poseBucket = poseBucket;
+            entry.m_clientInputId = m_reprocessingClientInputId;
+        }
+    }
+
+    void FirstPersonControllerComponent::AllocateReprocessingQueryCache()
+    {
+        static constexpr size_t ReprocessingQueryCacheHitsReserve = 4;
+        m_reprocessingQueryCache.clear();
+        m_reprocessingQueryCache.resize(ReprocessingQueryCacheInputWindow * ReprocessingQueryCount);
+        for (ReprocessingQueryCacheEntry& entry : m_reprocessingQueryCache)
+            entry.m_hits.m_hits.reserve(ReprocessingQueryCacheHitsReserve);
+    }
+
+    bool FirstPersonControllerComponent::GetSceneQueryHitsStatic(
+        AzPhysics::SceneHandle sceneHandle, const AZStd::vector<AzPhysics::SceneQueryHit>& hits) const
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        for (const AzPhysics::SceneQueryHit& hit : hits)
+        {
+            if (hit.m_entityId == GetEntityId() ||
+                AZStd::find(m_children.begin(), m_children.end(), hit.m_entityId) != m_children.end())
+                continue;
+            if (azrtti_cast<AzPhysics::StaticRigidBody*>(sceneInterface->GetSimulatedBodyFromHandle(sceneHandle, hit.m_bodyHandle)) ==
+                nullptr)
+                return false;
+        }
+        return true;
+    }
+
+    FirstPersonControllerComponent::GroundQueryKey FirstPersonControllerComponent::GetGroundQueryKey(
+        const AzPhysics::ShapeCastRequest& request, const float radius)
+    {
+        GroundQueryKey key;
+        key.m_start = request.m_start.GetTranslation();
+        key.m_direction = request.m_direction;
+        key.m_distance = request.m_distance;
+        key.m_radius = radius;
+        key.m_collisionGroupMask = request.m_collisionGroup.GetMask();
+        return key;
+    }
+
+    bool FirstPersonControllerComponent::GetGroundQueryShapesMatch(const GroundQueryKey& a, const GroundQueryKey& b)
+    {
+        return a.m_distance == b.m_distance && a.m_radius == b.m_radius && a.m_collisionGroupMask == b.m_collisionGroupMask &&
+            a.m_direction.IsClose(b.m_direction, 0.f);
+    }
+
+    bool FirstPersonControllerComponent::GetGroundQueryCacheUsable(const ReprocessingQuery query, const GroundQueryKey& key) const
+    {
+        const GroundQueryCacheEntry& entry = m_groundQueryCacheEntries[static_cast<size_t>(query)];
+        if (!m_enableGroundQueryCache || !entry.m_valid || entry.m_age >= m_groundQueryCacheRefreshTicks ||
+            !GetGroundQueryShapesMatch(entry.m_key, key))
+            return false;
+
+        // Any motion along the cast axis can change what the cast reaches, so only sideways drift is tolerated
+        static constexpr float GroundQueryCacheAxisTolerance = 1e-4f;
+        const AZ::Vector3 moved = key.m_start - entry.m_key.m_start;
+        const float movedAlongAxis = moved.Dot(key.m_direction);
+        const float maxMove = m_groundQueryCacheMoveFraction * m_capsuleRadius;
+        return fabs(movedAlongAxis) <= GroundQueryCacheAxisTolerance &&
+            (moved - key.m_direction * movedAlongAxis).GetLengthSq() < maxMove * maxMove;
+    }
+
+    AzPhysics::SceneQueryHits FirstPersonControllerComponent::QueryGroundCached(
+        AzPhysics::SceneHandle sceneHandle, AzPhysics::ShapeCastRequest* request, ReprocessingQuery query, const float radius)
+    {
+        // Reprocessed inputs rewind the character, so their queries are left to the reprocessing cache
+        if (m_reprocessingInput)
+            return QuerySceneReprocessingCached(sceneHandle, request, query);
+
+        const GroundQueryKey key = GetGroundQueryKey(*request, radius);
+        GroundQueryCacheEntry& entry = m_groundQueryCacheEntries[static_cast<size_t>(query)];
+        if (GetGroundQueryCacheUsable(query, key))
+        {
+            // A cached floor that has since been removed from the scene has to be cast for again
+            if (GetSceneQueryHitsStatic(sceneHandle, entry.m_hits.m_hits))
+            {
+                ++entry.m_age;
+                ++m_tickStats.m_groundCacheHits;
+                return entry.m_hits;
+            }
+            entry.m_valid = false;
+        }
+
+        AzPhysics::SceneQueryHits hits;
+        if (TakeBatchedGroundQuery(query, key, hits))
+        {
+            ++m_tickStats.m_batchedSceneQueries;
+            // Recorded for reprocessing the same as a query made here
+            if (GetReprocessingQueryCacheInUse())
+                RecordReprocessingQuery(sceneHandle, query, GetReprocessingQueryPoseBucket(*request), hits);
+        }
+        else
+            hits = QuerySceneReprocessingCached(sceneHandle, request, query);
+
+        if (!m_enableGroundQueryCache)
+            return hits;
+        ++m_tickStats.m_groundCacheMisses;
+
+        // Missing the ground leaves nothing to be sure of, and moving bodies may have moved by the next tick
+        entry.m_valid = !hits.m_hits.empty() && GetSceneQueryHitsStatic(sceneHandle, hits.m_hits);
+        if (entry.m_valid)
+        {
+            entry.m_hits = hits;
+            entry.m_key = key;
+            entry.m_age = 0;
+        }
+        return hits;
+    }
+
+    void FirstPersonControllerComponent::QueueFrameStageQueries([[maybe_unused]] const FrameStage stage, SceneQueryBatch& batch)
+    {
+        // Only a frame tick that runs the motion pipeline casts for the ground during this stage
+        QueueGroundQueries(batch, !m_addVelocityForTimestepVsTick && !m_networkFPCEnabled);
+    }
+
+    void FirstPersonControllerComponent::QueueTickStageQueries(const TickStage stage, SceneQueryBatch& batch)
+    {
+        // The same ticks that run the motion pipeline in ProcessInput. Each character moves during its own network tick on the
+        // server or host, so a batch queued ahead of the first one would miss the moves of the characters before it
+        const bool castsForGround = stage == TickStage::NetworkTick
+            ? m_networkFPCEnabled && m_isAutonomousClient
+            : m_addVelocityForTimestepVsTick && (!m_networkFPCEnabled || m_isServer);
+        QueueGroundQueries(batch, castsForGround);
+    }
+
+    void FirstPersonControllerComponent::QueueGroundQueries(SceneQueryBatch& batch, const bool castsForGround)
+    {
+        for (GroundQueryBatchEntry& entry : m_groundQueryBatchEntries)
+            entry.m_ticket = SceneQueryBatch::InvalidTicket;
+        m_groundQueryBatch = nullptr;
+
+        if (!castsForGround || !m_enableGroundQueryBatch || m_idleSleeping)
+            return;
+
+        AZ::Transform sphereCastPose = AZ::Transform::CreateIdentity();
+        AZ::Vector3 sphereCastDirection = AZ::Vector3::CreateAxisZ(-1.f);
+        GetGroundSphereCastPose(sphereCastPose, sphereCastDirection);
+
+        const float groundSphereCastRadius = m_capsuleRadius * (1.f + m_groundSphereCastsRadiusPercentageIncrease / 100.f);
+        QueueGroundQuery(
+            batch, ReprocessingQuery::Grounded, groundSphereCastRadius, sphereCastPose, sphereCastDirection, m_groundedSphereCastOffset);
+        QueueGroundQuery(
+            batch,
+            ReprocessingQuery::GroundClose,
+            groundSphereCastRadius,
+            sphereCastPose,
+            sphereCastDirection,
+            m_groundCloseSphereCastOffset);
+        if (m_coyoteTime > 0.f && m_groundCloseCoyoteTimeRadiusPercentageIncrease > NoRadiusUseRaycast)
+        {
+            const float coyoteTimeRadius = m_capsuleRadius * (1.f + m_groundCloseCoyoteTimeRadiusPercentageIncrease / 100.f);
+            QueueGroundQuery(
+                batch,
+                ReprocessingQuery::GroundCloseCoyoteTime,
+                coyoteTimeRadius,
+                sphereCastPose,
+                sphereCastDirection,
+                m_groundCloseCoyoteTimeOffset);
+        }
+
+        m_groundQueryBatch = &batch;
+    }
+
+    void FirstPersonControllerComponent::QueueGroundQuery(
+        SceneQueryBatch& batch,
+        const ReprocessingQuery query,
+        const float radius,
+        const AZ::Transform& sphereCastPose,
+        const AZ::Vector3& sphereCastDirection,
+        const float distance)
+    {
+        // Each query's request and sphere are allocated once and rewritten every time the query is batched
+        GroundQueryBatchEntry& entry = m_groundQueryBatchEntries[static_cast<size_t>(query)];
+        if (entry.m_request == nullptr)
+            entry.m_request = AZStd::make_shared<AzPhysics::ShapeCastRequest>(
+                CreateGroundSphereCastRequest(radius, sphereCastPose, sphereCastDirection, distance));
+        else
+        {
+            static_cast<Physics::SphereShapeConfiguration*>(entry.m_request->m_shapeConfiguration.get())->m_radius = radius;
+            entry.m_request->m_start = sphereCastPose;
+            entry.m_request->m_direction = sphereCastDirection;
+            entry.m_request->m_distance = distance;
+            entry.m_request->m_collisionGroup = m_groundedCollisionGroup;
+        }
+
+        const GroundQueryKey key = GetGroundQueryKey(*entry.m_request, radius);
+
+        // The cached result will be used instead
+        if (GetGroundQueryCacheUsable(query, key))
+            return;
+
+        entry.m_key = key;
+        entry.m_ticket = batch.Queue(entry.m_request);
+    }
+
+    bool FirstPersonControllerComponent::TakeBatchedGroundQuery(
+        const ReprocessingQuery query, const GroundQueryKey& key, AzPhysics::SceneQueryHits& hits)
+    {
+        if (m_groundQueryBatch == nullptr)
+            return false;
+
+        // Each batched result is used at most once, and only by the same cast from the same pose
+        GroundQueryBatchEntry& entry = m_groundQueryBatchEntries[static_cast<size_t>(query)];
+        const SceneQueryBatch::Ticket ticket = entry.m_ticket;
+        entry.m_ticket = SceneQueryBatch::InvalidTicket;
+        if (ticket == SceneQueryBatch::InvalidTicket || !GetGroundQueryShapesMatch(entry.m_key, key) ||
+            !entry.m_key.m_start.IsClose(key.m_start, 0.f))
+            return false;
+
+        return m_groundQueryBatch->Take(ticket, hits);
+    }
+
+    void FirstPersonControllerComponent::InvalidateGroundQueryCache()
+    {
+        for (GroundQueryCacheEntry& entry : m_groundQueryCacheEntries)
+        {
+            entry.m_valid = false;
+            entry.m_hits.m_hits.clear();
+        }
+    }
+
+    float FirstPersonControllerComponent::TraceInputs(const float deltaTime, const AZ::u8 tickTimestepNetwork)
+    {
+        // Inputs replayed after a correction were already traced when they were first processed
+        if ((!m_inputTrace.IsRecording() && !m_inputTrace.IsReplaying()) || (tickTimestepNetwork == 2 && m_reprocessingInput))
+            return deltaTime;
+
+        float* values[InputTraceRecord::ValueCount] = {
+            &m_forwardValue, &m_backValue,           &m_leftValue,        &m_rightValue,  &m_yawValue, &m_pitchValue,
+            &m_sprintValue,  &m_sprintEffectiveValue, &m_sprintAccelValue, &m_crouchValue, &m_jumpValue
+        };
+
+        InputTraceRecord record;
+        if (m_inputTrace.IsRecording())
+        {
+            record.m_tickTimestepNetwork = tickTimestepNetwork;
+            record.m_deltaTime = deltaTime;
+            for (size_t i = 0; i < InputTraceRecord::ValueCount; ++i)
+                record.m_values[i] = *values[i];
+            m_inputTrace.Record(record);
+            return deltaTime;
+        }
+
+        if (!m_inputTrace.Replay(tickTimestepNetwork, record))
+        {
+            AZ_Printf("First Person Controller Component", "%s: input replay finished.", GetEntity()->GetName().c_str());
+            m_inputTrace.Stop();
+            for (float* value : values)
+                *value = 0.f;
+            return deltaTime;
+        }
+
+        for (size_t i = 0; i < InputTraceRecord::ValueCount; ++i)
+            *values[i] = record.m_values[i];
+        return record.m_deltaTime;
+    }
+
     // Frame tick == 0, physics fixed timestep == 1, network tick == 2
-    void FirstPersonControllerComponent::ProcessInput(const float deltaTime, const AZ::u8 tickTimestepNetwork)
+    void FirstPersonControllerComponent::ProcessInput(const float tickDeltaTime, const AZ::u8 tickTimestepNetwork)
     {
+        FPC_PROFILE_STAGE(ProcessInput);
+
+        const size_t allocatedBytesAtTickStart = AZ::AllocatorInstance<AZ::SystemAllocator>::Get().NumAllocatedBytes();
+
+        // The raw mouse movement is consumed before the inputs are traced so the trace holds this tick's yaw and pitch. With NetworkFPC
+        // it is consumed per network tick when the input is created
+        if (m_rawMouseLook && !m_networkFPCEnabled && !m_inputTrace.IsReplaying() && m_enableCameraCharacterRotation &&
+            (tickTimestepNetwork == 0 || tickTimestepNetwork == 2))
+            ConsumeRawMouseLook();
+
+        const float deltaTime = TraceInputs(tickDeltaTime, tickTimestepNetwork);
+
         if (tickTimestepNetwork == 2)
         {
             // Get the various NetworkFPC properties, synchronizing with the server
@@ -4239,6 +4843,13 @@ namespace FirstPersonController
             (tickTimestepNetwork == 1 && m_addVelocityForTimestepVsTick && (!m_networkFPCEnabled || m_isServer)) ||
             (tickTimestepNetwork == 0 && !m_addVelocityForTimestepVsTick && !m_networkFPCEnabled))
         {
+            // A sleeping character skips the pipeline until something could move it
+            if (UpdateIdleSleep())
+            {
+                PublishTickStats(allocatedBytesAtTickStart);
+                return;
+            }
+
             // Perform the check to see if the character's movement is obstructed
             CheckCharacterMovementObstructed();
 
@@ -4290,7 +4901,11 @@ namespace FirstPersonController
                 // Set the NetworkFPC properties, informing the server of the client's latest simulation
                 SetNetworkFPCProperties();
 #ifdef NETWORKFPC
-                m_networkFPCControllerObject->SetDesiredVelocity(m_prevTargetVelocity);
+                // The desired velocity is carried in the next input, so it's only replicated when the observed state isn't derived
+                if (m_networkFPCControllerObject->GetDeriveObservedState())
+                    m_networkFPCControllerObject->m_desiredVelocity = m_prevTargetVelocity;
+                else
+                    m_networkFPCControllerObject->SetDesiredVelocity(m_prevTargetVelocity);
 #endif
             }
             else if (m_addVelocityForTimestepVsTick)
@@ -4302,7 +4917,137 @@ namespace FirstPersonController
             else
                 Physics::CharacterRequestBus::Event(
                     GetEntityId(), &Physics::CharacterRequestBus::Events::AddVelocityForTick, m_prevTargetVelocity);
+
+            PublishTickStats(allocatedBytesAtTickStart);
+        }
+    }
+
+    bool FirstPersonControllerComponent::IsIdleQuiet() const
+    {
+        // No input, nothing pending from scripts, and standing still on the ground with nothing left to settle
+        return m_forwardValue == 0.f && m_backValue == 0.f && m_leftValue == 0.f && m_rightValue == 0.f && m_sprintValue == 0.f &&
+            m_crouchValue == 0.f && m_jumpValue == 0.f && !m_scriptJump && !m_scriptSetsTargetVelocityXY && !m_scriptSetGroundTick &&
+            !m_scriptSetGroundCloseTick && m_grounded && !m_jumpHeld && !m_crouchJumpPending && !m_jumpCoyoteGravityPending &&
+            !m_crouchingDownMove && !m_standingUpMove && m_applyVelocityXY.IsZero() && m_applyVelocityZ == 0.f &&
+            m_applyVelocityXYFromImpulse.IsZero() && m_velocityFromImpulse.IsZero() && m_linearImpulse.IsZero() &&
+            m_addVelocityWorld.IsZero() && m_addVelocityHeading.IsZero() && m_prevTargetVelocity.IsZero() && m_currentVelocity.IsZero() &&
+            m_sprintHeldDuration == 0.f && m_sprintCooldownTimer == 0.f;
+    }
+
+    bool FirstPersonControllerComponent::UpdateIdleSleep()
+    {
+        // Reprocessed inputs are always simulated in full, so the corrected state is reproduced exactly
+        if (!m_enableIdleSleep || m_reprocessingInput || !IsIdleQuiet())
+        {
+            LeaveIdleSleep();
+            return false;
+        }
+
+        if (m_idleSleeping)
+        {
+            bool disturbed = m_idleSleepWakeRequested || m_crouching != m_idleSleepCrouching ||
+                !GetEntity()->GetTransform()->GetWorldTranslation().IsClose(m_idleSleepTranslation, 0.f);
+            for (auto it = m_idleSleepGroundTMs.begin(); !disturbed && it != m_idleSleepGroundTMs.end(); ++it)
+            {
+                AZ::Transform groundTM = AZ::Transform::CreateIdentity();
+                AZ::TransformBus::EventResult(groundTM, it->first, &AZ::TransformBus::Events::GetWorldTM);
+                disturbed = !groundTM.IsClose(it->second, 0.f);
+            }
+
+            if (!disturbed)
+                return true;
+
+            LeaveIdleSleep();
+            return false;
         }
+
+        if (++m_idleQuietTickCount >= m_idleSleepQuietTicks)
+            EnterIdleSleep();
+        return false;
+    }
+
+    void FirstPersonControllerComponent::EnterIdleSleep()
+    {
+        m_idleQuietTickCount = 0;
+
+        // Only sleep on static bodies, anything else beneath the character could move it at any time
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        const AzPhysics::SceneHandle sceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
+        for (const AzPhysics::SceneQueryHit& hit : m_groundHits)
+        {
+            if (azrtti_cast<AzPhysics::StaticRigidBody*>(sceneInterface->GetSimulatedBodyFromHandle(sceneHandle, hit.m_bodyHandle)) ==
+                nullptr)
+                return;
+        }
+
+        m_idleSleepGroundTMs.clear();
+        for (const AzPhysics::SceneQueryHit& hit : m_groundHits)
+        {
+            AZ::Transform groundTM = AZ::Transform::CreateIdentity();
+            AZ::TransformBus::EventResult(groundTM, hit.m_entityId, &AZ::TransformBus::Events::GetWorldTM);
+            m_idleSleepGroundTMs.emplace_back(hit.m_entityId, groundTM);
+        }
+        m_idleSleepTranslation = GetEntity()->GetTransform()->GetWorldTranslation();
+        m_idleSleepCrouching = m_crouching;
+        m_idleSleepWakeRequested = false;
+
+        // Wake when a rigid body collides with the character or it overlaps a trigger
+        Physics::Character* character = nullptr;
+        Physics::CharacterRequestBus::EventResult(character, GetEntityId(), &Physics::CharacterRequestBus::Events::GetCharacter);
+        if (character != nullptr)
+        {
+            m_idleSleepCollisionHandler = AzPhysics::SimulatedBodyEvents::OnCollisionBegin::Handler(
+                [this]([[maybe_unused]] AzPhysics::SimulatedBodyHandle bodyHandle, [[maybe_unused]] const AzPhysics::CollisionEvent& event)
+                {
+                    m_idleSleepWakeRequested = true;
+                });
+            m_idleSleepTriggerHandler = AzPhysics::SimulatedBodyEvents::OnTriggerEnter::Handler(
+                [this]([[maybe_unused]] AzPhysics::SimulatedBodyHandle bodyHandle, [[maybe_unused]] const AzPhysics::TriggerEvent& event)
+                {
+                    m_idleSleepWakeRequested = true;
+                });
+            AzPhysics::SimulatedBodyEvents::RegisterOnCollisionBeginHandler(
+                character->m_sceneOwner, character->m_bodyHandle, m_idleSleepCollisionHandler);
+            AzPhysics::SimulatedBodyEvents::RegisterOnTriggerEnterHandler(
+                character->m_sceneOwner, character->m_bodyHandle, m_idleSleepTriggerHandler);
+        }
+
+        m_idleSleeping = true;
+    }
+
+    void FirstPersonControllerComponent::LeaveIdleSleep()
+    {
+        m_idleQuietTickCount = 0;
+        if (!m_idleSleeping)
+            return;
+
+        m_idleSleeping = false;
+        m_idleSleepWakeRequested = false;
+        m_idleSleepGroundTMs.clear();
+        m_idleSleepCollisionHandler.Disconnect();
+        m_idleSleepTriggerHandler.Disconnect();
+    }
+
+    void FirstPersonControllerComponent::PublishTickStats(const size_t allocatedBytesAtTickStart)
+    {
+        m_tickStats.m_allocatedBytes = static_cast<AZ::s64>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().NumAllocatedBytes()) -
+            static_cast<AZ::s64>(allocatedBytesAtTickStart);
+
+        AZ_PROFILE_DATAPOINT(FirstPersonController, m_tickStats.m_sceneQueries, "FirstPersonController: Scene Queries");
+        AZ_PROFILE_DATAPOINT(FirstPersonController, m_tickStats.m_hitsProcessed, "FirstPersonController: Hits Processed");
+        AZ_PROFILE_DATAPOINT(FirstPersonController, m_tickStats.m_hitsDiscarded, "FirstPersonController: Hits Discarded");
+        AZ_PROFILE_DATAPOINT(FirstPersonController, m_tickStats.m_busEvents, "FirstPersonController: Bus Events");
+        AZ_PROFILE_DATAPOINT(FirstPersonController, m_tickStats.m_groundCacheHits, "FirstPersonController: Ground Cache Hits");
+        AZ_PROFILE_DATAPOINT(FirstPersonController, m_tickStats.m_groundCacheMisses, "FirstPersonController: Ground Cache Misses");
+        AZ_PROFILE_DATAPOINT(FirstPersonController, m_tickStats.m_batchedSceneQueries, "FirstPersonController: Batched Scene Queries");
+        AZ_PROFILE_DATAPOINT(FirstPersonController, m_tickStats.m_allocatedBytes, "FirstPersonController: Allocated Bytes");
+
+        if (FirstPersonControllerRequests* firstPersonController = FirstPersonControllerInterface::Get())
+            if (firstPersonController->GetBenchmarkRunning())
+                firstPersonController->RecordBenchmarkSceneQueries(m_tickStats.m_sceneQueries);
+
+        m_lastTickStats = m_tickStats;
+        m_tickStats = FirstPersonControllerTickStats();
     }
 
     // Request Bus getter and setter methods for use in scripts
@@ -4365,7 +5110,11 @@ namespace FirstPersonController
     {
         m_makeCameraChildOfCharacter = makeCameraChildOfCharacter;
         if (m_makeCameraChildOfCharacter && !IsCameraChildOfCharacter())
+        {
+            // Write out the pending pose first, the compositor takes the reparented pose as its base afterwards
+            m_cameraPose.Apply();
             AZ::TransformBus::Event(m_cameraEntityId, &AZ::TransformBus::Events::SetParent, GetEntityId());
+        }
     }
     bool FirstPersonControllerComponent::GetCameraSmoothFollow() const
     {
@@ -5489,6 +6238,23 @@ namespace FirstPersonController
         // 2 = StaticAndDynamic
         m_characterHitBy = characterHitBy;
     }
+    bool FirstPersonControllerComponent::GetCharacterHitsAdaptive() const
+    {
+        return m_characterHitsAdaptive;
+    }
+    void FirstPersonControllerComponent::SetCharacterHitsAdaptive(const bool characterHitsAdaptive)
+    {
+        m_characterHitsAdaptive = characterHitsAdaptive;
+        m_characterHitsIdleTickCount = m_characterHitsIdleSweepInterval;
+    }
+    AZ::u16 FirstPersonControllerComponent::GetCharacterHitsIdleSweepInterval() const
+    {
+        return m_characterHitsIdleSweepInterval;
+    }
+    void FirstPersonControllerComponent::SetCharacterHitsIdleSweepInterval(const AZ::u16 characterHitsIdleSweepInterval)
+    {
+        m_characterHitsIdleSweepInterval = AZStd::max<AZ::u16>(characterHitsIdleSweepInterval, 1);
+    }
     AZStd::vector<AZ::EntityId> FirstPersonControllerComponent::GetCharacterHitEntityIds() const
     {
         return m_characterHitEntityIds;
@@ -5629,10 +6395,14 @@ namespace FirstPersonController
     }
     bool FirstPersonControllerComponent::GetHeadHit() const
     {
+        // The head cast skipped by UpdateVelocityZ is run when the result is first asked for
+        if (m_headHitCastSkipped)
+            CastSkippedHeadHit();
         return m_headHit;
     }
     void FirstPersonControllerComponent::SetHeadHit(const bool headHit)
     {
+        m_headHitCastSkipped = false;
         m_headHit = headHit;
     }
     bool FirstPersonControllerComponent::GetJumpHeadIgnoreDynamicRigidBodies() const
@@ -5665,6 +6435,8 @@ namespace FirstPersonController
     }
     AZStd::vector<AZ::EntityId> FirstPersonControllerComponent::GetHeadHitEntityIds() const
     {
+        if (m_headHitCastSkipped)
+            CastSkippedHeadHit();
         return m_headHitEntityIds;
     }
     bool FirstPersonControllerComponent::GetJumpWhileCrouched() const
@@ -6493,6 +7265,33 @@ namespace FirstPersonController
     {
         m_rotationDamp = rotationDamp;
     }
+    bool FirstPersonControllerComponent::GetRawMouseLook() const
+    {
+        return m_rawMouseLook;
+    }
+    void FirstPersonControllerComponent::SetRawMouseLook(const bool rawMouseLook)
+    {
+        m_rawMouseLook = rawMouseLook;
+        m_rawMouseLookAccumulator.Clear();
+        m_yawValue = 0.f;
+        m_pitchValue = 0.f;
+    }
+    bool FirstPersonControllerComponent::GetRawMouseLookSubFrameInterpolation() const
+    {
+        return m_rawMouseLookSubFrameInterpolation;
+    }
+    void FirstPersonControllerComponent::SetRawMouseLookSubFrameInterpolation(const bool rawMouseLookSubFrameInterpolation)
+    {
+        m_rawMouseLookSubFrameInterpolation = rawMouseLookSubFrameInterpolation;
+    }
+    float FirstPersonControllerComponent::GetInputToCameraLatency() const
+    {
+        return m_inputToCameraLatency;
+    }
+    float FirstPersonControllerComponent::GetInputToCameraLatencyMax() const
+    {
+        return m_inputToCameraLatencyMax;
+    }
     AZ::TransformInterface* FirstPersonControllerComponent::GetCharacterTransformInterfacePtr() const
     {
         return GetEntity()->GetTransform();
@@ -6579,6 +7378,9 @@ namespace FirstPersonController
     void FirstPersonControllerComponent::SetIsNetBot(const bool isNetBot)
     {
         m_isNetBot = isNetBot;
+        // Move a character that was already added to the server's lists into the other list
+        if (!m_stringNetEntityIdOnServer.empty())
+            AddCharacterOnServer(isNetBot);
     }
 #ifdef NETWORKFPC
     AZStd::string FirstPersonControllerComponent::GetStringNetEntityIdById(const AZ::EntityId& entityId) const
@@ -6614,6 +7416,10 @@ namespace FirstPersonController
             return AZ::EntityId(AZ::EntityId::InvalidEntityId);
     }
 #endif
+    const FirstPersonControllerCorrectionStats& FirstPersonControllerComponent::GetCorrectionStats() const
+    {
+        return m_correctionStats;
+    }
     AZStd::vector<AZ::EntityId> FirstPersonControllerComponent::GetPlayerEntityIdsOnServer()
     {
         AZ::EBusAggregateResults<AZ::EntityId> characterEntityIds;
@@ -6704,6 +7510,55 @@ namespace FirstPersonController
 #endif
         return m_botStringNetEntityIds;
     }
+    void FirstPersonControllerComponent::AddCharacterOnServer([[maybe_unused]] const bool isNetBot)
+    {
+#if AZ_TRAIT_SERVER
+        const Multiplayer::INetworkEntityManager* networkEntityManager = Multiplayer::GetMultiplayer()->GetNetworkEntityManager();
+        AZStd::string stringNetEntityId = AZStd::to_string(networkEntityManager->GetNetEntityIdById(GetEntityId()));
+        RemoveCharacterOnServer();
+        m_stringNetEntityIdOnServer = AZStd::move(stringNetEntityId);
+        if (isNetBot)
+        {
+            m_netBotEntityIdsOnServer.push_back(GetEntityId());
+            m_botStringNetEntityIds.push_back(m_stringNetEntityIdOnServer);
+        }
+        else
+        {
+            m_playerEntityIdsOnServer.push_back(GetEntityId());
+            m_playerStringNetEntityIds.push_back(m_stringNetEntityIdOnServer);
+        }
+        ++m_playerBotStringNetEntityIdsVersion;
+#endif
+    }
+    void FirstPersonControllerComponent::RemoveCharacterOnServer()
+    {
+#if AZ_TRAIT_SERVER
+        // Only characters added to the lists are removed, with the key stored when they were added since the NetEntityId may no longer
+        // resolve while the entity deactivates
+        if (m_stringNetEntityIdOnServer.empty())
+            return;
+        const auto removeFrom = [this](AZStd::vector<AZ::EntityId>& entityIds, AZStd::vector<AZStd::string>& stringNetEntityIds)
+        {
+            const size_t erased = AZStd::erase(entityIds, GetEntityId()) + AZStd::erase(stringNetEntityIds, m_stringNetEntityIdOnServer);
+            return erased > 0;
+        };
+        const bool removedPlayer = removeFrom(m_playerEntityIdsOnServer, m_playerStringNetEntityIds);
+        const bool removedBot = removeFrom(m_netBotEntityIdsOnServer, m_botStringNetEntityIds);
+        m_stringNetEntityIdOnServer.clear();
+        if (removedPlayer || removedBot)
+            ++m_playerBotStringNetEntityIdsVersion;
+#endif
+    }
+    void FirstPersonControllerComponent::SetPlayerBotStringNetEntityIdsProperties() const
+    {
+#ifdef NETWORKFPC
+        if (m_networkFPCControllerObject->m_playerBotStringNetEntityIdsVersion == m_playerBotStringNetEntityIdsVersion)
+            return;
+        m_networkFPCControllerObject->SetPlayerStringNetEntityIds(m_playerStringNetEntityIds);
+        m_networkFPCControllerObject->SetBotStringNetEntityIds(m_botStringNetEntityIds);
+        m_networkFPCControllerObject->m_playerBotStringNetEntityIdsVersion = m_playerBotStringNetEntityIdsVersion;
+#endif
+    }
     AZStd::vector<AZ::EntityId> FirstPersonControllerComponent::GetOtherPlayerEntityIds() const
     {
         return m_otherPlayerEntityIds;
@@ -6813,6 +7668,121 @@ namespace FirstPersonController
         return false;
 #endif
     }
+    bool FirstPersonControllerComponent::StartInputRecording(const AZStd::string& path)
+    {
+        const bool started = m_inputTrace.StartRecording(path.c_str());
+        AZ_Warning("First Person Controller Component", started, "Unable to record inputs to %s.", path.c_str());
+        return started;
+    }
+    bool FirstPersonControllerComponent::StartInputReplay(const AZStd::string& path)
+    {
+        const bool started = m_inputTrace.StartReplay(path.c_str());
+        AZ_Warning("First Person Controller Component", started, "Unable to replay inputs from %s.", path.c_str());
+        return started;
+    }
+    void FirstPersonControllerComponent::StopInputTrace()
+    {
+        m_inputTrace.Stop();
+    }
+    bool FirstPersonControllerComponent::GetInputRecording() const
+    {
+        return m_inputTrace.IsRecording();
+    }
+    bool FirstPersonControllerComponent::GetInputReplaying() const
+    {
+        return m_inputTrace.IsReplaying();
+    }
+    AZ::u32 FirstPersonControllerComponent::GetTickSceneQueryCount() const
+    {
+        return m_lastTickStats.m_sceneQueries;
+    }
+    AZ::u32 FirstPersonControllerComponent::GetTickHitsProcessedCount() const
+    {
+        return m_lastTickStats.m_hitsProcessed;
+    }
+    AZ::u32 FirstPersonControllerComponent::GetTickHitsDiscardedCount() const
+    {
+        return m_lastTickStats.m_hitsDiscarded;
+    }
+    AZ::u32 FirstPersonControllerComponent::GetTickBusEventCount() const
+    {
+        return m_lastTickStats.m_busEvents;
+    }
+    AZ::s64 FirstPersonControllerComponent::GetTickAllocatedBytes() const
+    {
+        return m_lastTickStats.m_allocatedBytes;
+    }
+    bool FirstPersonControllerComponent::GetEnableIdleSleep() const
+    {
+        return m_enableIdleSleep;
+    }
+    void FirstPersonControllerComponent::SetEnableIdleSleep(const bool enableIdleSleep)
+    {
+        m_enableIdleSleep = enableIdleSleep;
+        if (!m_enableIdleSleep)
+            LeaveIdleSleep();
+    }
+    AZ::u16 FirstPersonControllerComponent::GetIdleSleepQuietTicks() const
+    {
+        return m_idleSleepQuietTicks;
+    }
+    void FirstPersonControllerComponent::SetIdleSleepQuietTicks(const AZ::u16 idleSleepQuietTicks)
+    {
+        m_idleSleepQuietTicks = AZStd::max<AZ::u16>(idleSleepQuietTicks, 1);
+    }
+    bool FirstPersonControllerComponent::GetIdleSleeping() const
+    {
+        return m_idleSleeping;
+    }
+    void FirstPersonControllerComponent::WakeFromIdleSleep()
+    {
+        LeaveIdleSleep();
+    }
+    bool FirstPersonControllerComponent::GetEnableGroundQueryCache() const
+    {
+        return m_enableGroundQueryCache;
+    }
+    void FirstPersonControllerComponent::SetEnableGroundQueryCache(const bool enableGroundQueryCache)
+    {
+        m_enableGroundQueryCache = enableGroundQueryCache;
+        InvalidateGroundQueryCache();
+    }
+    float FirstPersonControllerComponent::GetGroundQueryCacheMoveFraction() const
+    {
+        return m_groundQueryCacheMoveFraction;
+    }
+    void FirstPersonControllerComponent::SetGroundQueryCacheMoveFraction(const float groundQueryCacheMoveFraction)
+    {
+        m_groundQueryCacheMoveFraction = AZ::GetMax(groundQueryCacheMoveFraction, 0.f);
+    }
+    AZ::u16 FirstPersonControllerComponent::GetGroundQueryCacheRefreshTicks() const
+    {
+        return m_groundQueryCacheRefreshTicks;
+    }
+    void FirstPersonControllerComponent::SetGroundQueryCacheRefreshTicks(const AZ::u16 groundQueryCacheRefreshTicks)
+    {
+        m_groundQueryCacheRefreshTicks = AZStd::max<AZ::u16>(groundQueryCacheRefreshTicks, 1);
+    }
+    AZ::u32 FirstPersonControllerComponent::GetTickGroundCacheHits() const
+    {
+        return m_lastTickStats.m_groundCacheHits;
+    }
+    AZ::u32 FirstPersonControllerComponent::GetTickGroundCacheMisses() const
+    {
+        return m_lastTickStats.m_groundCacheMisses;
+    }
+    AZ::u32 FirstPersonControllerComponent::GetTickBatchedSceneQueryCount() const
+    {
+        return m_lastTickStats.m_batchedSceneQueries;
+    }
+    bool FirstPersonControllerComponent::GetEnableGroundQueryBatch() const
+    {
+        return m_enableGroundQueryBatch;
+    }
+    void FirstPersonControllerComponent::SetEnableGroundQueryBatch(const bool enableGroundQueryBatch)
+    {
+        m_enableGroundQueryBatch = enableGroundQueryBatch;
+    }
     void FirstPersonControllerComponent::IgnoreInputs(const bool ignoreInputs)
     {
         if (ignoreInputs)
@@ -6828,7 +7798,7 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::IsAutonomousSoConnect()
     {
-        AZ::TickBus::Handler::BusConnect();
+        FrameStageConnect(FrameStage::Controller);
         InputChannelEventListener::Connect();
         Camera::CameraNotificationBus::Handler::BusConnect();
         const bool addVelocityForTimestepVsTick = m_addVelocityForTimestepVsTick;
@@ -6836,7 +7806,7 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::NotAutonomousSoDisconnect()
     {
-        AZ::TickBus::Handler::BusDisconnect();
+        FrameStageDisconnect();
         InputChannelEventListener::Disconnect();
         Camera::CameraNotificationBus::Handler::BusDisconnect();
         m_attachedSceneHandle = AzPhysics::InvalidSceneHandle;
@@ -10,17 +10,28 @@
 #endif
 #include <FirstPersonController/PidController.h>
 
+#include <Clients/CameraPoseCompositor.h>
+#include <Clients/CharacterMotionCore.h>
+#include <Clients/FirstPersonControllerStats.h>
+#include <Clients/FrameStageGraph.h>
+#include <Clients/InputEventDispatchTable.h>
+#include <Clients/InputTrace.h>
+#include <Clients/RawMouseLookAccumulator.h>
+
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Math/Quaternion.h>
 #include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/deque.h>
 #include <AzCore/std/containers/map.h>
 
 #include <AzFramework/Components/CameraBus.h>
 #include <AzFramework/Input/Events/InputChannelEventListener.h>
 #include <AzFramework/Physics/CharacterBus.h>
 #include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
+#include <AzFramework/Physics/Common/PhysicsSimulatedBodyEvents.h>
 
 #include <StartingPointInput/InputEventNotificationBus.h>
 
@@ -35,7 +46,7 @@ namespace FirstPersonController
 
     class FirstPersonControllerComponent
         : public AZ::Component
-        , public AZ::TickBus::Handler
+        , public FrameStageHandler
         , protected Physics::CharacterNotificationBus::Handler
 #ifdef NETWORKFPC
         , public NetworkFPCControllerNotificationBus::Handler
@@ -84,9 +95,13 @@ namespace FirstPersonController
         // Gamepad Events
         void OnGamepadEvent(const AzFramework::InputChannel& inputChannel);
 
-        // TickBus interface
-        void OnTick(float deltaTime, AZ::ScriptTimePoint) override;
-        int GetTickOrder() override;
+        // Raw mouse movement events, used for camera rotation when Raw Mouse Look is enabled
+        void OnRawMouseEvent(const AzFramework::InputChannel& inputChannel);
+
+        // FrameStageHandler interface
+        void OnFrameStage(const FrameStage stage, const float deltaTime) override;
+        void QueueFrameStageQueries(const FrameStage stage, SceneQueryBatch& batch) override;
+        void QueueTickStageQueries(const TickStage stage, SceneQueryBatch& batch) override;
 
         // NetworkFPCControllerNotificationBus
         void OnNetworkTickStart(const float deltaTime, const bool server, const AZ::EntityId& entityId);
@@ -276,6 +291,10 @@ namespace FirstPersonController
         void SetCharacterHitBy(const AzPhysics::SceneQuery::QueryType& characterHitBy) override;
         AZStd::vector<AZ::EntityId> GetCharacterHitEntityIds() const override;
         AZStd::vector<AzPhysics::SceneQueryHit> GetCharacterSceneQueryHits() const override;
+        bool GetCharacterHitsAdaptive() const override;
+        void SetCharacterHitsAdaptive(const bool characterHitsAdaptive) override;
+        AZ::u16 GetCharacterHitsIdleSweepInterval() const override;
+        void SetCharacterHitsIdleSweepInterval(const AZ::u16 characterHitsIdleSweepInterval) override;
         float GetJumpInitialVelocity() const override;
         void SetJumpInitialVelocity(const float jumpInitialVelocity) override;
         float GetJumpSecondInitialVelocity() const override;
@@ -488,6 +507,12 @@ namespace FirstPersonController
         void SetCameraPitchMinAngleDegrees(const float pitchMinAngleDegrees) override;
         float GetCameraRotationDampFactor() const override;
         void SetCameraRotationDampFactor(const float rotationDamp) override;
+        bool GetRawMouseLook() const override;
+        void SetRawMouseLook(const bool rawMouseLook) override;
+        bool GetRawMouseLookSubFrameInterpolation() const override;
+        void SetRawMouseLookSubFrameInterpolation(const bool rawMouseLookSubFrameInterpolation) override;
+        float GetInputToCameraLatency() const override;
+        float GetInputToCameraLatencyMax() const override;
         AZ::TransformInterface* GetCharacterTransformInterfacePtr() const override;
         AZ::Transform GetCharacterTransform() const override;
         void SetCharacterTransform(const AZ::Transform& characterTransform) override;
@@ -540,6 +565,7 @@ namespace FirstPersonController
         static float GetSceneQueryHitStaticFriction(const AzPhysics::SceneQueryHit& hit);
         static float GetSceneQueryHitRestitution(const AzPhysics::SceneQueryHit& hit);
         static Physics::Shape* GetSceneQueryHitShapePtr(const AzPhysics::SceneQueryHit& hit);
+        const FirstPersonControllerCorrectionStats& GetCorrectionStats() const;
         static AZStd::vector<AZ::EntityId> GetPlayerEntityIdsOnServer();
         static AZStd::vector<AZStd::string> GetPlayerStringNetEntityIdsOnServer();
         static AZStd::vector<AZ::EntityId> GetNetBotEntityIdsOnServer();
@@ -557,6 +583,33 @@ namespace FirstPersonController
         void SetLocallyEnableNetworkFPC(const bool networkFPCEnabled) override;
         bool GetIsNetworkingActive() const override;
         void IgnoreInputs(const bool ignoreInputs) override;
+        bool StartInputRecording(const AZStd::string& path) override;
+        bool StartInputReplay(const AZStd::string& path) override;
+        void StopInputTrace() override;
+        bool GetInputRecording() const override;
+        bool GetInputReplaying() const override;
+        AZ::u32 GetTickSceneQueryCount() const override;
+        AZ::u32 GetTickHitsProcessedCount() const override;
+        AZ::u32 GetTickHitsDiscardedCount() const override;
+        AZ::u32 GetTickBusEventCount() const override;
+        AZ::s64 GetTickAllocatedBytes() const override;
+        bool GetEnableIdleSleep() const override;
+        void SetEnableIdleSleep(const bool enableIdleSleep) override;
+        AZ::u16 GetIdleSleepQuietTicks() const override;
+        void SetIdleSleepQuietTicks(const AZ::u16 idleSleepQuietTicks) override;
+        bool GetIdleSleeping() const override;
+        void WakeFromIdleSleep() override;
+        bool GetEnableGroundQueryCache() const override;
+        void SetEnableGroundQueryCache(const bool enableGroundQueryCache) override;
+        float GetGroundQueryCacheMoveFraction() const override;
+        void SetGroundQueryCacheMoveFraction(const float groundQueryCacheMoveFraction) override;
+        AZ::u16 GetGroundQueryCacheRefreshTicks() const override;
+        void SetGroundQueryCacheRefreshTicks(const AZ::u16 groundQueryCacheRefreshTicks) override;
+        AZ::u32 GetTickGroundCacheHits() const override;
+        AZ::u32 GetTickGroundCacheMisses() const override;
+        AZ::u32 GetTickBatchedSceneQueryCount() const override;
+        bool GetEnableGroundQueryBatch() const override;
+        void SetEnableGroundQueryBatch(const bool enableGroundQueryBatch) override;
         void IsAutonomousSoConnect() override;
         void NotAutonomousSoDisconnect() override;
 
@@ -564,7 +617,13 @@ namespace FirstPersonController
         inline static AZStd::vector<AZStd::string> m_playerStringNetEntityIds;
         inline static AZStd::vector<AZ::EntityId> m_netBotEntityIdsOnServer;
         inline static AZStd::vector<AZStd::string> m_botStringNetEntityIds;
-        inline static bool m_reacquirePlayerBotStringNetEntityIds = true;
+
+        // Incremental maintenance of the server's player and bot lists, each character is added once the server knows its type
+        void AddCharacterOnServer(const bool isNetBot);
+        void RemoveCharacterOnServer();
+        // The string NetEntityId this character was added to the server's lists with, and is removed with, empty until added
+        AZStd::string m_stringNetEntityIdOnServer;
+        inline static AZ::u32 m_playerBotStringNetEntityIdsVersion = 1;
 
     private:
         // Input event assignment and notification bus connection
@@ -596,24 +655,90 @@ namespace FirstPersonController
         // Whether to force the camera to be a child of the character entity
         bool m_makeCameraChildOfCharacter = false;
 
-        // Child EntityIds
-        bool m_obtainedChildIds = false;
-        AZStd::vector<AZ::EntityId> m_children;
+        // Child EntityIds, obtained lazily including from the const head hit getters
+        mutable bool m_obtainedChildIds = false;
+        mutable AZStd::vector<AZ::EntityId> m_children;
 
         // Called on each tick
-        void ProcessInput(const float deltaTime, const AZ::u8 tickTimestepNetwork);
+        void ProcessInput(const float tickDeltaTime, const AZ::u8 tickTimestepNetwork);
+
+        // Records the tick's inputs, or replaces them with the recorded ones, returning the delta time to process the tick with
+        float TraceInputs(const float deltaTime, const AZ::u8 tickTimestepNetwork);
+        InputTrace m_inputTrace;
+
+        // Counters of the motion tick in progress, published to m_lastTickStats and the profiler once the tick completes
+        mutable FirstPersonControllerTickStats m_tickStats;
+        FirstPersonControllerTickStats m_lastTickStats;
+        void PublishTickStats(const size_t allocatedBytesAtTickStart);
+
+        // Idle sleep skips the motion pipeline for a character that has stood still without input on static ground for
+        // m_idleSleepQuietTicks ticks, until an input, impulse, script change, ground movement, contact or trigger wakes it
+        bool m_enableIdleSleep = false;
+        AZ::u16 m_idleSleepQuietTicks = 60;
+        AZ::u16 m_idleQuietTickCount = 0;
+        bool m_idleSleeping = false;
+        bool m_idleSleepWakeRequested = false;
+        bool m_idleSleepCrouching = false;
+        AZ::Vector3 m_idleSleepTranslation = AZ::Vector3::CreateZero();
+        AZStd::vector<AZStd::pair<AZ::EntityId, AZ::Transform>> m_idleSleepGroundTMs;
+        AzPhysics::SimulatedBodyEvents::OnCollisionBegin::Handler m_idleSleepCollisionHandler;
+        AzPhysics::SimulatedBodyEvents::OnTriggerEnter::Handler m_idleSleepTriggerHandler;
+        bool IsIdleQuiet() const;
+        bool UpdateIdleSleep();
+        void EnterIdleSleep();
+        void LeaveIdleSleep();
+
+        // Sends a notification to this character's handlers, counting it in the tick stats
+        template<typename Function, typename... Args>
+        void Notify(Function&& function, Args&&... args) const
+        {
+            ++m_tickStats.m_busEvents;
+            FirstPersonControllerComponentNotificationBus::Event(
+                GetEntityId(), AZStd::forward<Function>(function), AZStd::forward<Args>(args)...);
+        }
+
+        // Removes the hits that the filter returns true for, counting the hits processed and discarded in the tick stats
+        template<typename Filter>
+        void FilterSceneQueryHits(AzPhysics::SceneQueryHits& hits, Filter&& filter) const
+        {
+            const size_t hitCount = hits.m_hits.size();
+            AZStd::erase_if(hits.m_hits, AZStd::forward<Filter>(filter));
+            m_tickStats.m_hitsProcessed += static_cast<AZ::u32>(hitCount);
+            m_tickStats.m_hitsDiscarded += static_cast<AZ::u32>(hitCount - hits.m_hits.size());
+        }
 
         // Various methods used to implement the First Person Controller functionality
+        void GetGroundSphereCastPose(AZ::Transform& sphereCastPose, AZ::Vector3& sphereCastDirection) const;
+        AzPhysics::ShapeCastRequest CreateGroundSphereCastRequest(
+            const float radius, const AZ::Transform& sphereCastPose, const AZ::Vector3& sphereCastDirection, const float distance) const;
+        // The ground close coyote time cast is a raycast at or below this radius percentage increase
+        static constexpr float NoRadiusUseRaycast = -100.f;
         void CheckGrounded(const float deltaTime);
         void UpdateVelocityXY(const float deltaTime);
         void AcquireSumOfGroundNormals();
         void UpdateJumpMaxHoldTime();
+        void CheckHeadHit();
+        // Casts for the head hit without sending OnHeadHit
+        void CastHeadHit();
+        // Runs the head cast UpdateVelocityZ skipped once a getter asks for the result, only touching the lazily updated state
+        void CastSkippedHeadHit() const;
+        AzPhysics::ShapeCastRequest CreateHeadHitRequest() const;
+        void SetHeadHitFromHits(AzPhysics::SceneQueryHits& hits) const;
         void UpdateVelocityZ(const float deltaTime);
         void UpdateRotation(const float deltaTime, const AZ::u8 tickTimestepNetwork);
         AZ::Vector2 LerpVelocityXY(const AZ::Vector2& targetVelocity, const float deltaTime);
+        CharacterMotionCore::StaminaParams GetStaminaParams() const;
+        CharacterMotionCore::StaminaState GetStaminaState() const;
+        void SetStaminaState(const CharacterMotionCore::StaminaState& state);
+        void NotifyStaminaEvents(const AZ::u8 events);
         void ApplyMovingUpInclineXYSpeedFactor();
+        CameraPoseCompositor* GetCameraPose();
         void LerpCameraToCharacter(const float deltaTime);
         void SmoothRotation();
+        void ConsumeRawMouseLook();
+        void RecordInputToCameraLatency(const AZ::s64 inputTimeUs, const float renderDelay);
+        void PushNetworkFPCLookRotationSample(const AZ::Vector3& lookRotationDelta);
+        AZ::Vector3 SampleNetworkFPCLookRotation(const float deltaTime);
         void ResetCameraToCharacter();
         void CaptureCharacterEyeTranslation();
         void SprintManager(const AZ::Vector2& targetVelocity, const float deltaTime);
@@ -621,8 +746,82 @@ namespace FirstPersonController
         void CheckCharacterMovementObstructed();
         void ProcessLinearImpulse(const float deltaTime);
         void ProcessCharacterHits(const float deltaTime);
+        // Overlaps the box bounding the hit shapecast, to tell whether the shapecast could hit anything besides this character and,
+        // when excludeKeptHits is set, the bodies of the kept m_characterHits, unless the ground it stands on already could be hit
+        bool GetCharacterHitCandidateNear(
+            AzPhysics::SceneHandle sceneHandle, const AzPhysics::ShapeCastRequest& request, const bool excludeKeptHits);
         void GetNetworkFPCProperties();
         void SetNetworkFPCProperties() const;
+        void SetPlayerBotStringNetEntityIdsProperties() const;
+
+        // Scene queries made during NetworkFPC input reprocessing reuse the static-only results recorded when the same input was
+        // first processed at the same pose
+        enum class ReprocessingQuery : AZ::u8
+        {
+            Grounded,
+            GroundClose,
+            GroundCloseCoyoteTime,
+            Head,
+            Stand
+        };
+        AzPhysics::SceneQueryHits QuerySceneReprocessingCached(
+            AzPhysics::SceneHandle sceneHandle, AzPhysics::ShapeCastRequest* request, ReprocessingQuery query);
+        bool GetReprocessingQueryCacheInUse() const;
+        AZStd::array<AZ::s32, 4> GetReprocessingQueryPoseBucket(const AzPhysics::ShapeCastRequest& request) const;
+        // Whether every hit is on a static body, or on this character or one of its children
+        bool GetSceneQueryHitsStatic(AzPhysics::SceneHandle sceneHandle, const AZStd::vector<AzPhysics::SceneQueryHit>& hits) const;
+
+        // Ground queries reuse the previous tick's hits while they were all static and the character has since moved less than
+        // m_groundQueryCacheMoveFraction of its capsule radius with no motion along the cast axis, refreshing every
+        // m_groundQueryCacheRefreshTicks reuses or as soon as a cached body is no longer in the scene
+        AzPhysics::SceneQueryHits QueryGroundCached(
+            AzPhysics::SceneHandle sceneHandle, AzPhysics::ShapeCastRequest* request, ReprocessingQuery query, const float radius);
+        void InvalidateGroundQueryCache();
+        struct GroundQueryKey
+        {
+            AZ::Vector3 m_start = AZ::Vector3::CreateZero();
+            AZ::Vector3 m_direction = AZ::Vector3::CreateZero();
+            float m_distance = 0.f;
+            float m_radius = 0.f;
+            AZ::u64 m_collisionGroupMask = 0;
+        };
+        static GroundQueryKey GetGroundQueryKey(const AzPhysics::ShapeCastRequest& request, const float radius);
+        // Whether the two casts are the same apart from where they start
+        static bool GetGroundQueryShapesMatch(const GroundQueryKey& a, const GroundQueryKey& b);
+        bool GetGroundQueryCacheUsable(const ReprocessingQuery query, const GroundQueryKey& key) const;
+        struct GroundQueryCacheEntry
+        {
+            AzPhysics::SceneQueryHits m_hits;
+            GroundQueryKey m_key;
+            AZ::u16 m_age = 0;
+            bool m_valid = false;
+        };
+        static constexpr size_t GroundQueryCount = static_cast<size_t>(ReprocessingQuery::GroundCloseCoyoteTime) + 1;
+        AZStd::array<GroundQueryCacheEntry, GroundQueryCount> m_groundQueryCacheEntries;
+        bool m_enableGroundQueryCache = false;
+        float m_groundQueryCacheMoveFraction = 0.02f;
+        AZ::u16 m_groundQueryCacheRefreshTicks = 10;
+
+        // The ground casts are queued before the Controller stage, or before the first character starts a physics timestep or, on
+        // the autonomous client, a network tick, and run in one batch with every other character's
+        void QueueGroundQueries(SceneQueryBatch& batch, const bool castsForGround);
+        void QueueGroundQuery(
+            SceneQueryBatch& batch,
+            const ReprocessingQuery query,
+            const float radius,
+            const AZ::Transform& sphereCastPose,
+            const AZ::Vector3& sphereCastDirection,
+            const float distance);
+        bool TakeBatchedGroundQuery(const ReprocessingQuery query, const GroundQueryKey& key, AzPhysics::SceneQueryHits& hits);
+        struct GroundQueryBatchEntry
+        {
+            GroundQueryKey m_key;
+            SceneQueryBatch::Ticket m_ticket = SceneQueryBatch::InvalidTicket;
+            AZStd::shared_ptr<AzPhysics::ShapeCastRequest> m_request;
+        };
+        AZStd::array<GroundQueryBatchEntry, GroundQueryCount> m_groundQueryBatchEntries;
+        SceneQueryBatch* m_groundQueryBatch = nullptr;
+        bool m_enableGroundQueryBatch = true;
 
         // Method for getting a pointer to an entity
         AZ::Entity* GetEntityPtr(const AZ::EntityId& entityId) const;
@@ -637,6 +836,30 @@ namespace FirstPersonController
         float m_prevTimestep = 1.f / 60.f;
         float m_prevNetworkFPCDeltaTime = 0.033f;
 
+        // NetworkFPC reprocessing scene query cache, a ring indexed by client input ID and query, allocated once on the autonomous
+        // client. Each slot holds the newest static result for its input and query along with the bucketed cast start and distance
+        struct ReprocessingQueryCacheEntry
+        {
+            AzPhysics::SceneQueryHits m_hits;
+            AZStd::array<AZ::s32, 4> m_poseBucket = {};
+            AZ::u16 m_clientInputId = 0;
+            bool m_valid = false;
+        };
+        static constexpr size_t ReprocessingQueryCount = static_cast<size_t>(ReprocessingQuery::Stand) + 1;
+        static constexpr size_t ReprocessingQueryCacheInputWindow = 128;
+        ReprocessingQueryCacheEntry& GetReprocessingQueryCacheEntry(const ReprocessingQuery query);
+        void RecordReprocessingQuery(
+            AzPhysics::SceneHandle sceneHandle,
+            const ReprocessingQuery query,
+            const AZStd::array<AZ::s32, 4>& poseBucket,
+            const AzPhysics::SceneQueryHits& hits);
+        void AllocateReprocessingQueryCache();
+        AZStd::vector<ReprocessingQueryCacheEntry> m_reprocessingQueryCache;
+        bool m_reprocessingQueryCacheActive = false;
+        bool m_reprocessingInput = false;
+        AZ::u16 m_reprocessingClientInputId = 0;
+        float m_reprocessingQueryPoseBucket = 0.01f;
+
         // Provides the functionality when AddVelocityForPhysicsTimestep is used
         void OnSceneSimulationStart(float physicsTimestep);
         void OnSceneSimulationFinish([[maybe_unused]] float physicsTimestep);
@@ -645,9 +868,8 @@ namespace FirstPersonController
         AzPhysics::SceneHandle m_attachedSceneHandle = AzPhysics::InvalidSceneHandle;
         bool m_addVelocityForTimestepVsTick = true;
         bool m_cameraSmoothFollow = true;
-        bool m_cameraTranslationOverwritten = false;
-        bool m_cameraLocalZOverwritten = false;
-        bool m_cameraRotationOverwritten = false;
+        // Every write to the active camera's pose goes through this, so the camera transform is written once per frame
+        CameraPoseCompositor m_cameraPose;
         float m_physicsTimestepScaleFactor = 1.f;
 
         // Camera interpolation variables
@@ -656,6 +878,28 @@ namespace FirstPersonController
         AZ::Vector3 m_prevCharacterEyeTranslation = AZ::Vector3::CreateZero();
         AZ::Vector3 m_currentCharacterEyeTranslation = AZ::Vector3::CreateZero();
 
+        // NetworkFPC correction reconciliation, the camera keeps a visual offset from the corrected eye translation which decays over
+        // m_correctionSmoothingTime, corrections larger than m_correctionSmoothingMaxDistance are not smoothed
+        enum class CorrectionSmoothingMode : AZ::u8
+        {
+            None,
+            Exponential,
+            CriticallyDampedSpring
+        };
+        void BeginCorrectionReconciliation();
+        void FinishCorrectionReconciliation();
+        void DecayCorrectionVisualOffset(const float deltaTime);
+        CorrectionSmoothingMode m_correctionSmoothingMode = CorrectionSmoothingMode::None;
+        float m_correctionSmoothingTime = 0.1f;
+        float m_correctionSmoothingMaxDistance = 1.f;
+        bool m_correctionReconciling = false;
+        AZ::Vector3 m_correctionEyeTranslation = AZ::Vector3::CreateZero();
+        AZ::Vector3 m_correctionVisualOffset = AZ::Vector3::CreateZero();
+        AZ::Vector3 m_correctionVisualOffsetVelocity = AZ::Vector3::CreateZero();
+
+        // Correction magnitude statistics, reported by net_FPCCorrectionStats
+        FirstPersonControllerCorrectionStats m_correctionStats;
+
         // Velocity application variables
         AZ::Vector2 m_applyVelocityXY = AZ::Vector2::CreateZero();
         AZ::Vector2 m_nextLikelyApplyVelocityXY = AZ::Vector2::CreateZero();
@@ -846,7 +1090,9 @@ namespace FirstPersonController
         bool m_applyGravityDuringCoyoteTime = false;
         bool m_jumpHeadIgnoreDynamicRigidBodies = true;
         bool m_jumpWhileCrouched = false;
-        bool m_headHit = false;
+        // The head hit state is updated lazily by the const getters when UpdateVelocityZ skipped the cast
+        mutable bool m_headHit = false;
+        mutable bool m_headHitCastSkipped = false;
         bool m_headHitSetsApogee = true;
         float m_fellFromHeight = 0.f;
         float m_fellDistance = 0.f;
@@ -855,7 +1101,7 @@ namespace FirstPersonController
         AzPhysics::CollisionGroup m_headCollisionGroup = AzPhysics::CollisionGroup::All;
         AZStd::vector<AZ::EntityId> m_characterHitEntityIds;
         AZStd::vector<AZ::EntityId> m_groundHitEntityIds;
-        AZStd::vector<AZ::EntityId> m_headHitEntityIds;
+        mutable AZStd::vector<AZ::EntityId> m_headHitEntityIds;
         float m_jumpHeadSphereCastOffset = 0.2f;
         bool m_onFirstJump = false;
         bool m_onGroundSoonHit = false;
@@ -883,6 +1129,9 @@ namespace FirstPersonController
         AzPhysics::CollisionGroup m_characterHitCollisionGroup = AzPhysics::CollisionGroup::All;
         AzPhysics::SceneQuery::QueryType m_characterHitBy = AzPhysics::SceneQuery::QueryType::StaticAndDynamic;
         AZStd::vector<AzPhysics::SceneQueryHit> m_characterHits;
+        bool m_characterHitsAdaptive = false;
+        AZ::u16 m_characterHitsIdleSweepInterval = 4;
+        AZ::u16 m_characterHitsIdleTickCount = 4;
 
         // Networking related variables (Note: m_isNetBot is true by default because it is set to false by NetworkFPC when autonomous)
         bool m_networkFPCEnabled = false;
@@ -899,8 +1148,14 @@ namespace FirstPersonController
         bool m_networkFPCCameraAligned = false;
         // To have the camera not follow the character with multiplayer, m_cameraSmoothFollow will have to be set false as well
         bool m_networkFPCKeepCameraAtCharacter = true;
-        float m_networkFPCRotationSliceAccumulator = 0.f;
-        float m_networkFPCYawOvershootAngle = 0.f;
+        // Look rotation samples from network ticks, timed in seconds relative to the current frame
+        struct NetworkFPCLookRotationSample
+        {
+            float m_time;
+            AZ::Vector3 m_lookRotation;
+        };
+        static constexpr size_t NetworkFPCLookRotationSamplesMax = 8;
+        AZStd::deque<NetworkFPCLookRotationSample> m_networkFPCLookRotationSamples;
 
         // Variables used to determine when the X&Y velocity should be updated
         bool m_updateXYAscending = true;
@@ -912,6 +1167,15 @@ namespace FirstPersonController
         float m_pitchSensitivity = 0.0035f;
         float m_yawSensitivity = 0.0035f;
 
+        // Raw mouse look, where every mouse movement event between ticks is summed with its timestamp instead of taking the
+        // Yaw and Pitch input event values once per frame
+        bool m_rawMouseLook = false;
+        bool m_rawMouseLookSubFrameInterpolation = true;
+        RawMouseLookAccumulator m_rawMouseLookAccumulator;
+        // Time in seconds from the oldest mouse movement applied to the camera until it was applied, last and largest
+        float m_inputToCameraLatency = 0.f;
+        float m_inputToCameraLatencyMax = 0.f;
+
         // Rotation-related variables
         bool m_enableCameraCharacterRotation = true;
         float m_currentHeading = 0.f;
@@ -1004,5 +1268,8 @@ namespace FirstPersonController
             { &m_moveRightEventId, &m_rightValue },     { &m_rotateYawEventId, &m_yawValue }, { &m_rotatePitchEventId, &m_pitchValue },
             { &m_sprintEventId, &m_sprintValue },       { &m_crouchEventId, &m_crouchValue }, { &m_jumpEventId, &m_jumpValue }
         };
+
+        // Event IDs resolved from m_controlMap in AssignConnectInputEvents, looked up on each input notification
+        InputEventDispatchTable m_inputDispatchTable;
     };
 } // namespace FirstPersonController
@@ -0,0 +1,101 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <FirstPersonController/FirstPersonControllerBus.h>
+
+#include <AzCore/Debug/Budget.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/chrono/chrono.h>
+
+namespace FirstPersonController
+{
+    // Profiler budget of the First Person Controller, Extras and NetworkFPC stages
+    AZ_DECLARE_BUDGET(FirstPersonController);
+
+    // Work done by a character over one motion tick, reported to the profiler and through the request bus
+    struct FirstPersonControllerTickStats
+    {
+        AZ::u32 m_sceneQueries = 0;
+        AZ::u32 m_hitsProcessed = 0;
+        AZ::u32 m_hitsDiscarded = 0;
+        AZ::u32 m_busEvents = 0;
+        AZ::u32 m_groundCacheHits = 0;
+        AZ::u32 m_groundCacheMisses = 0;
+        // Queries made for the character in a batch with other characters' rather than through m_sceneQueries
+        AZ::u32 m_batchedSceneQueries = 0;
+        // Net change of the system allocator's allocated bytes, which includes allocations made on other threads during the tick
+        AZ::s64 m_allocatedBytes = 0;
+    };
+
+    // Magnitudes of the NetworkFPC corrections reconciled on the autonomous client, reported by net_FPCCorrectionStats
+    struct FirstPersonControllerCorrectionStats
+    {
+        AZ::u32 m_count = 0;
+        AZ::u32 m_snapCount = 0;
+        float m_magnitudeSum = 0.f;
+        float m_magnitudeMax = 0.f;
+        float m_magnitudeLast = 0.f;
+    };
+
+    // Profiler and benchmark report names of the BenchmarkStage values
+    static constexpr const char* BenchmarkStageNames[] = { "ProcessInput",
+                                                           "UpdateRotation",
+                                                           "LerpCameraToCharacter",
+                                                           "ResetCameraToCharacter",
+                                                           "ApplyMovingUpInclineXYSpeedFactor",
+                                                           "SprintManager",
+                                                           "CrouchManager",
+                                                           "UpdateVelocityXY",
+                                                           "AcquireSumOfGroundNormals",
+                                                           "CheckCharacterMovementObstructed",
+                                                           "CheckGrounded",
+                                                           "UpdateVelocityZ",
+                                                           "ProcessLinearImpulse",
+                                                           "ProcessCharacterHits",
+                                                           "GetNetworkFPCProperties",
+                                                           "SetNetworkFPCProperties",
+                                                           "Extras ProcessInput",
+                                                           "Extras UpdateHeadbob",
+                                                           "NetworkFPC CreateInput",
+                                                           "NetworkFPC ProcessInput" };
+    static_assert(AZStd::size(BenchmarkStageNames) == static_cast<size_t>(BenchmarkStage::Count), "A benchmark stage is missing its name");
+
+    // Times the enclosing scope as a benchmark stage while fpc_Benchmark is running
+    class FirstPersonControllerBenchmarkScope
+    {
+    public:
+        explicit FirstPersonControllerBenchmarkScope(const BenchmarkStage stage)
+            : m_stage(stage)
+        {
+            m_benchmark = FirstPersonControllerInterface::Get();
+            if (m_benchmark == nullptr || !m_benchmark->GetBenchmarkRunning())
+            {
+                m_benchmark = nullptr;
+                return;
+            }
+            m_benchmark->BeginBenchmarkStage();
+            m_start = AZStd::chrono::steady_clock::now();
+        }
+
+        ~FirstPersonControllerBenchmarkScope()
+        {
+            if (m_benchmark == nullptr)
+                return;
+            const AZStd::chrono::duration<float, AZStd::milli> elapsed = AZStd::chrono::steady_clock::now() - m_start;
+            m_benchmark->EndBenchmarkStage(m_stage, elapsed.count());
+        }
+
+    private:
+        BenchmarkStage m_stage;
+        FirstPersonControllerRequests* m_benchmark = nullptr;
+        AZStd::chrono::steady_clock::time_point m_start;
+    };
+
+// Profiler scope and benchmark stage of one controller pipeline stage
+#define FPC_PROFILE_STAGE(stage)                                                                                                           \
+    AZ_PROFILE_SCOPE(FirstPersonController, BenchmarkStageNames[static_cast<size_t>(BenchmarkStage::stage)]);                              \
+    FirstPersonControllerBenchmarkScope fpcBenchmarkScope(BenchmarkStage::stage)
+} // namespace FirstPersonController
@@ -9,9 +9,13 @@
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzFramework/Physics/SystemBus.h>
 #if __has_include(<Source/AutoGen/AutoComponentTypes.h>)
 #include <Source/AutoGen/AutoComponentTypes.h>
 #endif
+#ifdef NETWORKFPC
+#include <Multiplayer/IMultiplayer.h>
+#endif
 
 namespace FirstPersonController
 {
@@ -126,23 +130,138 @@ namespace FirstPersonController
         NetworkFPCBotAnimationRequestBus::Handler::BusConnect();
         // Register multiplayer components
         RegisterMultiplayerComponents();
+
+        // Register the NetworkFPC relevance filter, unless the project has already registered its own entity filter
+        Multiplayer::IMultiplayer* multiplayer = AZ::Interface<Multiplayer::IMultiplayer>::Get();
+        if (multiplayer != nullptr && multiplayer->GetFilterEntityManager() == nullptr)
+            multiplayer->SetFilterEntityManager(&m_networkFPCRelevanceFilter);
 #endif
     }
 
     void FirstPersonControllerSystemComponent::Deactivate()
     {
 #ifdef NETWORKFPC
+        Multiplayer::IMultiplayer* multiplayer = AZ::Interface<Multiplayer::IMultiplayer>::Get();
+        if (multiplayer != nullptr && multiplayer->GetFilterEntityManager() == &m_networkFPCRelevanceFilter)
+            multiplayer->SetFilterEntityManager(nullptr);
         NetworkFPCBotAnimationRequestBus::Handler::BusDisconnect();
         NetworkFPCRequestBus::Handler::BusDisconnect();
 #endif
+        m_sceneSimulationFinishHandler.Disconnect();
         AZ::TickBus::Handler::BusDisconnect();
         FirstPersonControllerRequestBus::Handler::BusDisconnect();
         FirstPersonExtrasRequestBus::Handler::BusDisconnect();
         CameraCoupledChildRequestBus::Handler::BusDisconnect();
     }
 
-    void FirstPersonControllerSystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    void FirstPersonControllerSystemComponent::OnTick(float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        m_frameStageGraph.Execute(deltaTime);
+        m_benchmark.OnFrame();
+
+        ++m_frameCount;
+        m_frameStageGraph.EndTickStage(TickStage::NetworkTick);
+    }
+
+    int FirstPersonControllerSystemComponent::GetTickOrder()
     {
+        return AZ::TICK_PRE_RENDER;
     }
 
+    void FirstPersonControllerSystemComponent::StartBenchmark(const AZ::u32 frames, const AZStd::string& outputPath)
+    {
+        m_benchmark.Start(frames, outputPath);
+    }
+
+    bool FirstPersonControllerSystemComponent::GetBenchmarkRunning() const
+    {
+        return m_benchmark.IsRunning();
+    }
+
+    void FirstPersonControllerSystemComponent::BeginBenchmarkStage()
+    {
+        m_benchmark.BeginStage();
+    }
+
+    void FirstPersonControllerSystemComponent::EndBenchmarkStage(const BenchmarkStage stage, const float milliseconds)
+    {
+        m_benchmark.EndStage(stage, milliseconds);
+    }
+
+    void FirstPersonControllerSystemComponent::RecordBenchmarkSceneQueries(const AZ::u32 sceneQueries)
+    {
+        m_benchmark.RecordSceneQueries(sceneQueries);
+    }
+
+    void FirstPersonControllerSystemComponent::AddFrameStageHandler(const FrameStage stage, FrameStageHandler* handler)
+    {
+        m_frameStageGraph.Add(stage, handler);
+    }
+
+    void FirstPersonControllerSystemComponent::RemoveFrameStageHandler(const FrameStage stage, FrameStageHandler* handler)
+    {
+        m_frameStageGraph.Remove(stage, handler);
+    }
+
+    void FirstPersonControllerSystemComponent::BeginTickStage(const TickStage stage)
+    {
+        if (stage != TickStage::PhysicsTimestep)
+        {
+            m_frameStageGraph.BeginTickStage(stage, m_frameCount);
+            return;
+        }
+
+        // The physics step's batch is ended by the default scene, connected to once a character first ticks on it
+        if (!m_sceneSimulationFinishHandler.IsConnected())
+        {
+            AzPhysics::SceneHandle defaultSceneHandle = AzPhysics::InvalidSceneHandle;
+            Physics::DefaultWorldBus::BroadcastResult(defaultSceneHandle, &Physics::DefaultWorldRequests::GetDefaultSceneHandle);
+            auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+            if (defaultSceneHandle == AzPhysics::InvalidSceneHandle || sceneInterface == nullptr)
+                return;
+
+            m_sceneSimulationFinishHandler = AzPhysics::SceneEvents::OnSceneSimulationFinishHandler(
+                [this]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] float fixedDeltaTime)
+                {
+                    ++m_physicsTimestepCount;
+                    m_frameStageGraph.EndTickStage(TickStage::PhysicsTimestep);
+                });
+            sceneInterface->RegisterSceneSimulationFinishHandler(defaultSceneHandle, m_sceneSimulationFinishHandler);
+        }
+        m_frameStageGraph.BeginTickStage(stage, m_physicsTimestepCount);
+    }
+
+#ifdef NETWORKFPC
+    void FirstPersonControllerSystemComponent::RecordNetworkFPCPropertyUpdate(
+        const AZ::u32 connectionId, const AZ::u16 statId, const size_t bytes)
+    {
+        m_networkFPCPropertyStats.Record(connectionId, statId, bytes);
+    }
+
+    AZ::u64 FirstPersonControllerSystemComponent::GetNetworkFPCPropertyUpdateCount(const AZStd::string& name) const
+    {
+        return m_networkFPCPropertyStats.GetUpdateCount(name);
+    }
+
+    AZ::u64 FirstPersonControllerSystemComponent::GetNetworkFPCPropertyBytes(const AZStd::string& name) const
+    {
+        return m_networkFPCPropertyStats.GetBytes(name);
+    }
+
+    float FirstPersonControllerSystemComponent::GetNetworkFPCPropertyUpdateRate(const AZStd::string& name) const
+    {
+        return m_networkFPCPropertyStats.GetUpdateRate(name);
+    }
+
+    void FirstPersonControllerSystemComponent::DumpNetworkFPCPropertyStats() const
+    {
+        m_networkFPCPropertyStats.Dump();
+    }
+
+    void FirstPersonControllerSystemComponent::ResetNetworkFPCPropertyStats()
+    {
+        m_networkFPCPropertyStats.Reset();
+    }
+#endif
+
 } // namespace FirstPersonController
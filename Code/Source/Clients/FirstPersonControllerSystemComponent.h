@@ -6,14 +6,20 @@
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzFramework/Physics/PhysicsScene.h>
 #include <FirstPersonController/CameraCoupledChildBus.h>
 #include <FirstPersonController/FirstPersonControllerBus.h>
 #include <FirstPersonController/FirstPersonExtrasBus.h>
+
+#include <Clients/FirstPersonControllerBenchmark.h>
+#include <Clients/FrameStageGraph.h>
 #ifdef NETWORKFPC
 #include <FirstPersonController/NetworkFPCBotAnimationBus.h>
 #include <FirstPersonController/NetworkFPCBotAnimationControllerBus.h>
 #include <FirstPersonController/NetworkFPCBus.h>
 #include <FirstPersonController/NetworkFPCControllerBus.h>
+#include <Multiplayer/NetworkFPC.h>
+#include <Multiplayer/NetworkFPCPropertyStats.h>
 #endif
 
 namespace FirstPersonController
@@ -45,7 +51,14 @@ namespace FirstPersonController
     protected:
         ////////////////////////////////////////////////////////////////////////
         // FirstPersonControllerRequestBus interface implementation
-
+        void StartBenchmark(const AZ::u32 frames, const AZStd::string& outputPath) override;
+        bool GetBenchmarkRunning() const override;
+        void BeginBenchmarkStage() override;
+        void EndBenchmarkStage(const BenchmarkStage stage, const float milliseconds) override;
+        void RecordBenchmarkSceneQueries(const AZ::u32 sceneQueries) override;
+        void AddFrameStageHandler(const FrameStage stage, FrameStageHandler* handler) override;
+        void RemoveFrameStageHandler(const FrameStage stage, FrameStageHandler* handler) override;
+        void BeginTickStage(const TickStage stage) override;
         ////////////////////////////////////////////////////////////////////////
 
         ////////////////////////////////////////////////////////////////////////
@@ -58,7 +71,38 @@ namespace FirstPersonController
         ////////////////////////////////////////////////////////////////////////
         // AZTickBus interface implementation
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+        ////////////////////////////////////////////////////////////////////////
+
+        // Benchmark of the controllers' cost, measured while fpc_Benchmark runs
+        FirstPersonControllerBenchmark m_benchmark;
+
+        // The controllers, extras, camera poses and coupled children, run stage by stage each frame
+        FrameStageGraph m_frameStageGraph;
+
+        // Tick stage batches are submitted once per physics step and once per frame, and cleared when it ends
+        AZ::u64 m_frameCount = 0;
+        AZ::u64 m_physicsTimestepCount = 0;
+        AzPhysics::SceneEvents::OnSceneSimulationFinishHandler m_sceneSimulationFinishHandler;
+
+#ifdef NETWORKFPC
+        ////////////////////////////////////////////////////////////////////////
+        // NetworkFPCRequestBus interface implementation
+        void RecordNetworkFPCPropertyUpdate(const AZ::u32 connectionId, const AZ::u16 statId, const size_t bytes) override;
+        AZ::u64 GetNetworkFPCPropertyUpdateCount(const AZStd::string& name) const override;
+        AZ::u64 GetNetworkFPCPropertyBytes(const AZStd::string& name) const override;
+        float GetNetworkFPCPropertyUpdateRate(const AZStd::string& name) const override;
+        void DumpNetworkFPCPropertyStats() const override;
+        void ResetNetworkFPCPropertyStats() override;
         ////////////////////////////////////////////////////////////////////////
+
+    private:
+        // Per-connection relevance filter for NetworkFPC characters
+        NetworkFPCRelevanceFilter m_networkFPCRelevanceFilter;
+
+        // NetworkFPC property and network input statistics
+        NetworkFPCPropertyStats m_networkFPCPropertyStats;
+#endif
     };
 
 } // namespace FirstPersonController
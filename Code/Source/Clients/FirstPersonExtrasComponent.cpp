@@ -253,7 +253,7 @@ namespace FirstPersonController
                     ->Attribute(AZ::Edit::Attributes::Min, 0.f)
                     ->Attribute(AZ::Edit::Attributes::Max, 0.25f)
                     ->Attribute(AZ::Edit::Attributes::Step, 0.005f)
-                    ->Attribute(AZ::Edit::Attributes::ChangeNotify, &FirstPersonExtrasComponent::UpdateHeadbobShapePeaks)
+                    ->Attribute(AZ::Edit::Attributes::ChangeNotify, &FirstPersonExtrasComponent::UpdateHeadbobShapeTables)
                     ->Attribute(Visibility, &FirstPersonExtrasComponent::GetHeadbobEnabledAndRealismGreaterThanZero)
                     ->DataElement(
                         AZ::Edit::UIHandlers::Slider,
@@ -263,7 +263,7 @@ namespace FirstPersonController
                     ->Attribute(AZ::Edit::Attributes::Min, 0.f)
                     ->Attribute(AZ::Edit::Attributes::Max, 2.f)
                     ->Attribute(AZ::Edit::Attributes::Step, 0.01f)
-                    ->Attribute(AZ::Edit::Attributes::ChangeNotify, &FirstPersonExtrasComponent::UpdateHeadbobShapePeaks)
+                    ->Attribute(AZ::Edit::Attributes::ChangeNotify, &FirstPersonExtrasComponent::UpdateHeadbobShapeTables)
                     ->Attribute(Visibility, &FirstPersonExtrasComponent::GetHeadbobEnabledAndRealismGreaterThanZero)
                     ->DataElement(
                         AZ::Edit::UIHandlers::Slider,
@@ -274,7 +274,7 @@ namespace FirstPersonController
                     ->Attribute(AZ::Edit::Attributes::Min, 0.f)
                     ->Attribute(AZ::Edit::Attributes::Max, 0.25f)
                     ->Attribute(AZ::Edit::Attributes::Step, 0.005f)
-                    ->Attribute(AZ::Edit::Attributes::ChangeNotify, &FirstPersonExtrasComponent::UpdateHeadbobShapePeaks)
+                    ->Attribute(AZ::Edit::Attributes::ChangeNotify, &FirstPersonExtrasComponent::UpdateHeadbobShapeTables)
                     ->Attribute(Visibility, &FirstPersonExtrasComponent::GetHeadbobEnabledAndRealismGreaterThanZero)
                     ->DataElement(
                         AZ::Edit::UIHandlers::Slider,
@@ -284,7 +284,7 @@ namespace FirstPersonController
                     ->Attribute(AZ::Edit::Attributes::Min, 0.f)
                     ->Attribute(AZ::Edit::Attributes::Max, 1.f / 9.f)
                     ->Attribute(AZ::Edit::Attributes::Step, 0.002f)
-                    ->Attribute(AZ::Edit::Attributes::ChangeNotify, &FirstPersonExtrasComponent::UpdateHeadbobShapePeaks)
+                    ->Attribute(AZ::Edit::Attributes::ChangeNotify, &FirstPersonExtrasComponent::UpdateHeadbobShapeTables)
                     ->Attribute(Visibility, &FirstPersonExtrasComponent::GetHeadbobEnabledAndRealismGreaterThanZero)
                     ->DataElement(
                         AZ::Edit::UIHandlers::Slider,
@@ -448,7 +448,7 @@ namespace FirstPersonController
 
     void FirstPersonExtrasComponent::Activate()
     {
-        AZ::TickBus::Handler::BusConnect();
+        FrameStageConnect(FrameStage::Extras);
         FirstPersonControllerComponentNotificationBus::Handler::BusConnect(GetEntityId());
 #ifdef NETWORKFPC
         NetworkFPCControllerNotificationBus::Handler::BusConnect(GetEntityId());
@@ -474,8 +474,8 @@ namespace FirstPersonController
         m_headAngleJump = AZ::DegToRad(m_headAngleJump);
         m_headAngleLand = AZ::DegToRad(m_headAngleLand);
 
-        // Compute the headbob waveform normalization from the serialized shaping values
-        UpdateHeadbobShapePeaks();
+        // Bake the headbob waveforms and their normalization from the serialized shaping values
+        UpdateHeadbobShapeTables();
 
         // Assign the FirstPersonExtrasComponent specific inputs
         AssignConnectInputEvents();
@@ -505,7 +505,6 @@ namespace FirstPersonController
             {
                 m_originalCameraTranslation = m_cameraEntityPtr->GetTransform()->GetLocalTranslation();
                 m_prevHeadbobOffset = AZ::Vector3::CreateZero();
-                m_prevHeadbobRotationOffset = AZ::Quaternion::CreateIdentity();
                 // Clear the smoothing state too, so a bob left over from a previous camera cannot bleed onto
                 // this one over the first smoothing time constant
                 m_smoothedHeadbobOffset = AZ::Vector3::CreateZero();
@@ -522,7 +521,7 @@ namespace FirstPersonController
         NetworkFPCControllerNotificationBus::Handler::BusDisconnect();
 #endif
         FirstPersonControllerComponentNotificationBus::Handler::BusDisconnect();
-        AZ::TickBus::Handler::BusDisconnect();
+        FrameStageDisconnect();
 
         // Headbob deactivation
         if (m_headbobEnabled)
@@ -532,6 +531,7 @@ namespace FirstPersonController
 
             AZ::EntityBus::Handler::BusDisconnect();
         }
+        m_headbobCameraPose.Unbind();
         m_cameraEntityPtr = nullptr;
     }
 
@@ -563,6 +563,7 @@ namespace FirstPersonController
         // Whenever a camera is added, use its FoV as the walking FoV value
         Camera::CameraRequestBus::EventResult(m_walkFoV, m_cameraEntityId, &Camera::CameraComponentRequests::GetFovDegrees);
         m_sprintFoV = m_walkFoV + m_sprintFoVDelta;
+        m_appliedFoV = m_walkFoV;
     }
 
     void FirstPersonExtrasComponent::OnActiveViewChanged(const AZ::EntityId& activeEntityId)
@@ -578,7 +579,6 @@ namespace FirstPersonController
 
                 m_originalCameraTranslation = m_cameraEntityPtr->GetTransform()->GetLocalTranslation();
                 m_prevHeadbobOffset = AZ::Vector3::CreateZero();
-                m_prevHeadbobRotationOffset = AZ::Quaternion::CreateIdentity();
                 // Clear the smoothing state too, so a bob left over from a previous camera cannot bleed onto
                 // this one over the first smoothing time constant
                 m_smoothedHeadbobOffset = AZ::Vector3::CreateZero();
@@ -612,7 +612,6 @@ namespace FirstPersonController
             {
                 m_originalCameraTranslation = m_cameraEntityPtr->GetTransform()->GetLocalTranslation();
                 m_prevHeadbobOffset = AZ::Vector3::CreateZero();
-                m_prevHeadbobRotationOffset = AZ::Quaternion::CreateIdentity();
                 // Clear the smoothing state too, so a bob left over from a previous camera cannot bleed onto
                 // this one over the first smoothing time constant
                 m_smoothedHeadbobOffset = AZ::Vector3::CreateZero();
@@ -654,6 +653,7 @@ namespace FirstPersonController
     {
         // Disconnect prior to connecting since this may be a reassignment
         InputEventNotificationBus::MultiHandler::BusDisconnect();
+        m_inputDispatchTable.Clear();
 
         if (m_controlMap.size() != (sizeof(m_inputNames) / sizeof(AZStd::string*)))
         {
@@ -665,6 +665,7 @@ namespace FirstPersonController
             {
                 *(it_event.first) = StartingPointInput::InputEventNotificationId(
                     (m_inputNames[std::distance(m_controlMap.begin(), m_controlMap.find(it_event.first))])->c_str());
+                m_inputDispatchTable.Add(*(it_event.first), it_event.second);
                 InputEventNotificationBus::MultiHandler::BusConnect(*(it_event.first));
             }
         }
@@ -676,15 +677,7 @@ namespace FirstPersonController
         if (inputId == nullptr)
             return;
 
-        for (auto& it_event : m_controlMap)
-        {
-            if (*inputId == *(it_event.first))
-            {
-                *(it_event.second) = value;
-                // print the local user ID and the action name CRC
-                // AZ_Printf("Pressed", it_event.first->ToString().c_str());
-            }
-        }
+        m_inputDispatchTable.Write(*inputId, value);
     }
 
     void FirstPersonExtrasComponent::OnReleased(float value)
@@ -693,27 +686,14 @@ namespace FirstPersonController
         if (inputId == nullptr)
             return;
 
-        for (auto& it_event : m_controlMap)
-        {
-            if (*inputId == *(it_event.first))
-            {
-                *(it_event.second) = value;
-                // print the local user ID and the action name CRC
-                // AZ_Printf("Released", it_event.first->ToString().c_str());
-            }
-        }
+        m_inputDispatchTable.Write(*inputId, value);
     }
 
     void FirstPersonExtrasComponent::OnHeld([[maybe_unused]] float value)
     {
     }
 
-    int FirstPersonExtrasComponent::GetTickOrder()
-    {
-        return AZ::TICK_PRE_RENDER + 1;
-    }
-
-    void FirstPersonExtrasComponent::OnTick(float deltaTime, AZ::ScriptTimePoint)
+    void FirstPersonExtrasComponent::OnFrameStage([[maybe_unused]] const FrameStage stage, const float deltaTime)
     {
         ProcessInput(deltaTime, 0);
     }
@@ -845,6 +825,8 @@ namespace FirstPersonController
             });
         const bool groundedRecently = !notRecentlyGrounded;
 
+        UpdateSprintingObstructed();
+
         // Scale the FoV based on the current speed, assuming forward is the fastest direction
         if (m_firstPersonControllerObject != nullptr &&
             (m_firstPersonControllerObject->m_sprintInAir || m_firstPersonControllerObject->m_coyoteTimeNoGravityActive ||
@@ -865,30 +847,33 @@ namespace FirstPersonController
             if (m_sprintFoVTimeAccumulator < 0.f)
                 m_sprintFoVTimeAccumulator = 0.f;
         }
-        // Lerp the FoV and apply it
+        // Lerp the FoV and apply it, each write rebuilds the camera's projection so only changes are written
         const float newCameraFoV = AZ::Lerp(m_walkFoV, m_sprintFoV, m_sprintFoVTimeAccumulator / m_sprintFoVLerpTime);
+        if (abs(newCameraFoV - m_appliedFoV) <= SprintFoVEpsilon)
+            return;
         Camera::CameraRequestBus::Event(m_cameraEntityId, &Camera::CameraComponentRequests::SetFovDegrees, newCameraFoV);
+        m_appliedFoV = newCameraFoV;
     }
 
-    bool FirstPersonExtrasComponent::GetSprinting()
+    void FirstPersonExtrasComponent::UpdateSprintingObstructed()
     {
-        float currentSpeed = m_firstPersonControllerObject->m_applyVelocityXY.GetLength();
-
-        // Check to see if sprinting is obstructed for several ticks in a row
-        m_sprintingObstructedCheck[m_sprintingObstructedIndex] =
-            m_firstPersonControllerObject->m_correctedVelocityXY.IsZero(m_firstPersonControllerObject->m_speed / 2.f);
+        // Check to see if sprinting is obstructed for several ticks in a row, keeping a count of the obstructed
+        // entries so the ring doesn't need to be scanned
+        const bool obstructed = m_firstPersonControllerObject->m_correctedVelocityXY.IsZero(m_firstPersonControllerObject->m_speed / 2.f);
+        bool& check = m_sprintingObstructedCheck[m_sprintingObstructedIndex];
+        m_sprintingObstructedCount += static_cast<AZ::u8>(obstructed) - static_cast<AZ::u8>(check);
+        check = obstructed;
         m_sprintingObstructedIndex++;
         if (m_sprintingObstructedIndex == AZStd::size(m_sprintingObstructedCheck))
             m_sprintingObstructedIndex = 0;
-        const bool sprintingObstructed = AZStd::all_of(
-            AZStd::begin(m_sprintingObstructedCheck),
-            AZStd::end(m_sprintingObstructedCheck),
-            [](bool sprintingObstructedCheckElement)
-            {
-                return sprintingObstructedCheckElement;
-            });
+        m_sprintingObstructed = m_sprintingObstructedCount == AZStd::size(m_sprintingObstructedCheck);
+    }
 
-        if (AZ::IsClose(currentSpeed, 0.f) || sprintingObstructed)
+    bool FirstPersonExtrasComponent::GetSprinting() const
+    {
+        float currentSpeed = m_firstPersonControllerObject->m_applyVelocityXY.GetLength();
+
+        if (AZ::IsClose(currentSpeed, 0.f) || m_sprintingObstructed)
             return false;
 
         float topWalkSpeedInDirection = m_firstPersonControllerObject->m_speed *
@@ -998,27 +983,28 @@ namespace FirstPersonController
             ForwardThirdHarmonicMagnitude * sinf(ForwardThirdHarmonicFreq * phase);
     }
 
-    void FirstPersonExtrasComponent::UpdateHeadbobShapePeaks()
+    void FirstPersonExtrasComponent::UpdateHeadbobShapeTables()
     {
-        // Sample one walk cycle to find each shape's peak, since there is no closed form for the peak
-        // of a harmonic sum
-        static constexpr AZ::u8 Samples = 255;
+        // Bake one walk cycle of each shape, since they only change with the shaping values. The peaks are
+        // found from the same samples, since there is no closed form for the peak of a harmonic sum
         float verticalPeak = 0.f;
         float horizontalPeak = 0.f;
         float forwardPeak = 0.f;
 
-        for (AZ::u8 sample = 0; sample < Samples; ++sample)
+        for (AZ::u32 sample = 0; sample < HeadbobShapeTableSamples; ++sample)
         {
-            const float phase = AZ::Constants::TwoPi * static_cast<float>(sample) / static_cast<float>(Samples);
+            const float phase = AZ::Constants::TwoPi * static_cast<float>(sample) / static_cast<float>(HeadbobShapeTableSamples);
 
-            const float verticalShape = CalculateHeadbobVerticalShape(phase);
-            verticalPeak = AZ::GetMax(verticalPeak, AZ::Abs(verticalShape));
+            m_headbobVerticalShapeTable[sample] = CalculateHeadbobVerticalShape(phase);
+            verticalPeak = AZ::GetMax(verticalPeak, AZ::Abs(m_headbobVerticalShapeTable[sample]));
 
-            const float horizontalShape = CalculateHeadbobHorizontalShape(phase);
-            horizontalPeak = AZ::GetMax(horizontalPeak, AZ::Abs(horizontalShape));
+            m_headbobHorizontalShapeTable[sample] = CalculateHeadbobHorizontalShape(phase);
+            horizontalPeak = AZ::GetMax(horizontalPeak, AZ::Abs(m_headbobHorizontalShapeTable[sample]));
 
-            const float forwardShape = CalculateHeadbobForwardShape(phase);
-            forwardPeak = AZ::GetMax(forwardPeak, AZ::Abs(forwardShape));
+            m_headbobForwardShapeTable[sample] = CalculateHeadbobForwardShape(phase);
+            forwardPeak = AZ::GetMax(forwardPeak, AZ::Abs(m_headbobForwardShapeTable[sample]));
+
+            m_headbobSineTable[sample] = sinf(phase);
         }
 
         // Guard against a shape that is flat zero, which would otherwise divide by zero
@@ -1027,10 +1013,22 @@ namespace FirstPersonController
         m_headbobForwardShapePeak = AZ::IsClose(forwardPeak, 0.f) ? 1.f : forwardPeak;
     }
 
-    // Recompute the shape peaks and refresh the editor
+    // Linearly interpolate between the two samples either side of the phase. Every shape has a whole
+    // number of periods per walk cycle, so any phase wraps onto the table
+    float FirstPersonExtrasComponent::SampleHeadbobShapeTable(const HeadbobShapeTable& table, const float phase)
+    {
+        static constexpr float SamplesPerRadian = static_cast<float>(HeadbobShapeTableSamples) / AZ::Constants::TwoPi;
+        static constexpr AZ::u32 IndexMask = HeadbobShapeTableSamples - 1;
+        const float position = phase * SamplesPerRadian;
+        const float floorPosition = floorf(position);
+        const AZ::u32 index = static_cast<AZ::u32>(static_cast<AZ::s64>(floorPosition)) & IndexMask;
+        return AZ::Lerp(table[index], table[(index + 1) & IndexMask], position - floorPosition);
+    }
+
+    // Rebake the shape tables and refresh the editor
     AZ::u32 FirstPersonExtrasComponent::OnHeadbobRealismChanged()
     {
-        UpdateHeadbobShapePeaks();
+        UpdateHeadbobShapeTables();
         return AZ::Edit::PropertyRefreshLevels::AttributesAndValues;
     }
 
@@ -1097,7 +1095,8 @@ namespace FirstPersonController
 
         // Vary the speed and size slightly over this many walk cycles so no two steps are exactly alike
         static constexpr float stepVariationCycles = 8.f;
-        const float stepWander = 1.f + m_headbobRealism * m_headbobStepVariationOverTime * sinf(m_headbobPhase / stepVariationCycles);
+        const float stepWanderShape = SampleHeadbobShapeTable(m_headbobSineTable, m_headbobPhase / stepVariationCycles);
+        const float stepWander = 1.f + m_headbobRealism * m_headbobStepVariationOverTime * stepWanderShape;
         effectiveHorizontalAmplitude *= stepWander;
         effectiveVerticalAmplitude *= stepWander;
 
@@ -1118,9 +1117,9 @@ namespace FirstPersonController
 
         // Compute the offsets using a Lemniscate of Gerono (figure-8 pattern for natural sway and
         // bounce), shaped by the measured harmonics when Realism is non-zero
-        float horizontalOffset =
-            m_headbobStartingDirection ? CalculateHeadbobHorizontalShape(m_headbobPhase) : -CalculateHeadbobHorizontalShape(m_headbobPhase);
-        float verticalOffset = CalculateHeadbobVerticalShape(m_headbobPhase);
+        const float horizontalShape = SampleHeadbobShapeTable(m_headbobHorizontalShapeTable, m_headbobPhase);
+        float horizontalOffset = m_headbobStartingDirection ? horizontalShape : -horizontalShape;
+        float verticalOffset = SampleHeadbobShapeTable(m_headbobVerticalShapeTable, m_headbobPhase);
 
         // Normalize the vertical waveform for the pitch below, which is an angle and so cannot be derived
         // from the metres the vertical bob travels, and for the step notifications
@@ -1136,7 +1135,7 @@ namespace FirstPersonController
         float forwardOffset = 0.f;
         if (m_headbobFootstepAcceleration != 0.f && m_headbobRealism != 0.f)
             forwardOffset = m_headbobRealism * m_headbobFootstepAcceleration * effectiveHorizontalAmplitude *
-                CalculateHeadbobForwardShape(m_headbobPhase) / m_headbobForwardShapePeak;
+                SampleHeadbobShapeTable(m_headbobForwardShapeTable, m_headbobPhase) / m_headbobForwardShapePeak;
 
         // Compute the head rotation riding on top of the bob, where the pitch counter-rotates against the
         // vertical bob and the roll lags the yaw by a fixed 30 degrees. All three take the rotation scale
@@ -1145,12 +1144,12 @@ namespace FirstPersonController
             rotationSpeedScale * m_headbobNormalizedVerticalShape;
         static constexpr float RollYawPhaseOffsetDeg = -30.f;
         const float rollOffset = directionSign * m_headbobRealism * m_headbobOverallIntensity * AZ::DegToRad(m_headbobMaxRollAmplitude) *
-            rotationSpeedScale * sinf(m_headbobPhase + AZ::DegToRad(RollYawPhaseOffsetDeg));
+            rotationSpeedScale * SampleHeadbobShapeTable(m_headbobSineTable, m_headbobPhase + AZ::DegToRad(RollYawPhaseOffsetDeg));
         const float yawOffset = directionSign * m_headbobRealism * m_headbobOverallIntensity * AZ::DegToRad(m_headbobMaxYawAmplitude) *
-            rotationSpeedScale * sinf(m_headbobPhase);
-        // Pitch about X (right), roll about Y (forward), yaw about Z (up)
-        m_headbobRotationOffset = AZ::Quaternion::CreateRotationX(pitchOffset) * AZ::Quaternion::CreateRotationY(rollOffset) *
-            AZ::Quaternion::CreateRotationZ(yawOffset);
+            rotationSpeedScale * SampleHeadbobShapeTable(m_headbobSineTable, m_headbobPhase);
+        // Pitch about X (right), roll about Y (forward), yaw about Z (up), composed in that order from one
+        // vectorized sine and cosine of the half angles
+        m_headbobRotationOffset = AZ::Quaternion::CreateFromEulerRadiansXYZ(AZ::Vector3(pitchOffset, rollOffset, yawOffset));
 
         // Create a vector from the offets, horizontal along X, forward along Y, vertical along Z
         const AZ::Vector3 offsetVector = AZ::Vector3(horizontalOffset, forwardOffset, verticalOffset);
@@ -1162,6 +1161,8 @@ namespace FirstPersonController
 
     void FirstPersonExtrasComponent::UpdateHeadbob(const float deltaTime)
     {
+        FPC_PROFILE_STAGE(ExtrasUpdateHeadbob);
+
         if (!m_headbobEnabled || m_cameraEntityPtr == nullptr)
             return;
 
@@ -1197,45 +1198,14 @@ namespace FirstPersonController
             m_headbobSmoothedVerticalShape = m_headbobNormalizedVerticalShape;
         }
 
-        auto* headbobEntityTransform = m_cameraEntityPtr->GetTransform();
-        const AZ::Vector3 currentCameraTranslation = headbobEntityTransform->GetLocalTM().GetTranslation();
-        const AZ::Quaternion currentLocalRotation = headbobEntityTransform->GetLocalTM().GetRotation();
-
-        // Get whether the First Person Controller replaced the camera's translation, or just its local Z
-        // in CrouchManager, and whether it replaced the rotation
-        const bool cameraTranslationOverwritten = m_firstPersonControllerObject->m_cameraTranslationOverwritten;
-        const bool cameraLocalZOverwritten = cameraTranslationOverwritten || m_firstPersonControllerObject->m_cameraLocalZOverwritten;
-        const bool cameraRotationOverwritten = m_firstPersonControllerObject->m_cameraRotationOverwritten;
-        m_firstPersonControllerObject->m_cameraTranslationOverwritten = false;
-        m_firstPersonControllerObject->m_cameraLocalZOverwritten = false;
-        m_firstPersonControllerObject->m_cameraRotationOverwritten = false;
-
-        // Get the "clean" local translation by removing the previous bob offset from the axes which still contain it
-        m_cameraTranslationWithoutHeadbob = currentCameraTranslation;
-        if (!cameraTranslationOverwritten)
-        {
-            m_cameraTranslationWithoutHeadbob.SetX(currentCameraTranslation.GetX() - m_prevHeadbobOffset.GetX());
-            m_cameraTranslationWithoutHeadbob.SetY(currentCameraTranslation.GetY() - m_prevHeadbobOffset.GetY());
-        }
-        if (!cameraLocalZOverwritten)
-            m_cameraTranslationWithoutHeadbob.SetZ(currentCameraTranslation.GetZ() - m_prevHeadbobOffset.GetZ());
-        // Compute the target local translation by adding the new bob offset to the clean position
-        const AZ::Vector3 targetLocalTranslation = m_cameraTranslationWithoutHeadbob + m_smoothedHeadbobOffset;
-
-        // Set local translation
-        headbobEntityTransform->SetLocalTranslation(targetLocalTranslation);
-        // Store the applied offset so it can be removed on the next update
+        // Add the bob on top of the camera pose composed this frame, the compositor writes the camera once after every
+        // contributor has run, so nothing has to be taken back off the camera on the next update
+        CameraPoseCompositor& cameraPose = GetHeadbobCameraPose();
+        m_cameraTranslationWithoutHeadbob = cameraPose.GetLocalTranslation();
+        cameraPose.AddTranslationOffset(m_smoothedHeadbobOffset);
+        cameraPose.AddRotationOffset(m_smoothedHeadbobRotationOffset);
         m_prevHeadbobOffset = m_smoothedHeadbobOffset;
 
-        // Recover the clean local rotation the same way. The pitch-delta branch leaves the previous
-        // sway in place and does not set the flag
-        const AZ::Quaternion cleanLocalRotation = cameraRotationOverwritten
-            ? currentLocalRotation
-            : (currentLocalRotation * m_prevHeadbobRotationOffset.GetInverseFull()).GetNormalized();
-        headbobEntityTransform->SetLocalRotationQuaternion((cleanLocalRotation * m_smoothedHeadbobRotationOffset).GetNormalized());
-        // Store the applied rotation so it can be removed on the next update
-        m_prevHeadbobRotationOffset = m_smoothedHeadbobRotationOffset;
-
         // Broadcast a notification everytime a "step" is taken from the figure-8 headbobbing pattern,
         // detected on the smoothed waveform. The m_isWalking gate stops the decay from counting as a step
         if (m_isWalking && !m_stepTaken && m_headbobSmoothedVerticalShape > m_prevHeadbobSmoothedVerticalShape)
@@ -1256,9 +1226,24 @@ namespace FirstPersonController
         m_prevHeadbobSmoothedVerticalShape = m_headbobSmoothedVerticalShape;
     }
 
+    CameraPoseCompositor& FirstPersonExtrasComponent::GetHeadbobCameraPose()
+    {
+        // Share the First Person Controller's compositor when the bob is applied to the camera it drives
+        if (m_cameraEntityPtr == m_firstPersonControllerObject->m_activeCameraEntity)
+        {
+            m_headbobCameraPose.Unbind();
+            return *m_firstPersonControllerObject->GetCameraPose();
+        }
+
+        m_headbobCameraPose.Bind(m_cameraEntityPtr->GetId());
+        return m_headbobCameraPose;
+    }
+
     // Frame tick == 0, physics fixed timestep == 1, network tick == 2
     void FirstPersonExtrasComponent::ProcessInput(const float deltaTime, const AZ::u8 tickTimestepNetwork)
     {
+        FPC_PROFILE_STAGE(ExtrasProcessInput);
+
         // Queue up jumps
         QueueJump(deltaTime, tickTimestepNetwork);
 
@@ -1564,7 +1549,7 @@ namespace FirstPersonController
             m_headbobRealism = 0.f;
         else
             m_headbobRealism = headbobRealism;
-        UpdateHeadbobShapePeaks();
+        UpdateHeadbobShapeTables();
     }
     float FirstPersonExtrasComponent::GetHeadbobFootstepSharpness() const
     {
@@ -1573,7 +1558,7 @@ namespace FirstPersonController
     void FirstPersonExtrasComponent::SetHeadbobFootstepSharpness(const float headbobFootstepSharpness)
     {
         m_headbobFootstepSharpness = headbobFootstepSharpness;
-        UpdateHeadbobShapePeaks();
+        UpdateHeadbobShapeTables();
     }
     float FirstPersonExtrasComponent::GetHeadbobAlternatingStepDifference() const
     {
@@ -1582,7 +1567,7 @@ namespace FirstPersonController
     void FirstPersonExtrasComponent::SetHeadbobAlternatingStepDifference(const float headbobAlternatingStepDifference)
     {
         m_headbobAlternatingStepDifference = headbobAlternatingStepDifference;
-        UpdateHeadbobShapePeaks();
+        UpdateHeadbobShapeTables();
     }
     float FirstPersonExtrasComponent::GetHeadbobHorizontalSwayImbalance() const
     {
@@ -1591,7 +1576,7 @@ namespace FirstPersonController
     void FirstPersonExtrasComponent::SetHeadbobHorizontalSwayImbalance(const float headbobHorizontalSwayImbalance)
     {
         m_headbobHorizontalSwayImbalance = headbobHorizontalSwayImbalance;
-        UpdateHeadbobShapePeaks();
+        UpdateHeadbobShapeTables();
     }
     float FirstPersonExtrasComponent::GetHeadbobHorizontalSwayFlatness() const
     {
@@ -1600,7 +1585,7 @@ namespace FirstPersonController
     void FirstPersonExtrasComponent::SetHeadbobHorizontalSwayFlatness(const float headbobHorizontalSwayFlatness)
     {
         m_headbobHorizontalSwayFlatness = headbobHorizontalSwayFlatness;
-        UpdateHeadbobShapePeaks();
+        UpdateHeadbobShapeTables();
     }
     float FirstPersonExtrasComponent::GetHeadbobFootstepAcceleration() const
     {
@@ -1741,12 +1726,12 @@ namespace FirstPersonController
     }
     void FirstPersonExtrasComponent::IsAutonomousSoConnect()
     {
-        AZ::TickBus::Handler::BusConnect();
+        FrameStageConnect(FrameStage::Extras);
         Camera::CameraNotificationBus::Handler::BusConnect();
     }
     void FirstPersonExtrasComponent::NotAutonomousSoDisconnect()
     {
-        AZ::TickBus::Handler::BusDisconnect();
+        FrameStageDisconnect();
         Camera::CameraNotificationBus::Handler::BusDisconnect();
     }
 } // namespace FirstPersonController
@@ -7,11 +7,13 @@
 #include <FirstPersonController/FirstPersonExtrasComponentBus.h>
 
 #include <Clients/FirstPersonControllerComponent.h>
+#include <Clients/FrameStageGraph.h>
+#include <Clients/InputEventDispatchTable.h>
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/EntityBus.h>
-#include <AzCore/Component/TickBus.h>
 #include <AzCore/Math/Quaternion.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/map.h>
 
 #include <AzFramework/Components/CameraBus.h>
@@ -24,7 +26,7 @@ namespace FirstPersonController
 
     class FirstPersonExtrasComponent
         : public AZ::Component
-        , public AZ::TickBus::Handler
+        , public FrameStageHandler
         , public AZ::EntityBus::Handler
         , public StartingPointInput::InputEventNotificationBus::MultiHandler
         , public FirstPersonControllerComponentNotificationBus::Handler
@@ -147,9 +149,8 @@ namespace FirstPersonController
         AZ::Entity* GetActiveCamera() const;
         AZ::Entity* GetEntityPtr(AZ::EntityId pointer) const;
 
-        // TickBus interface
-        void OnTick(float deltaTime, AZ::ScriptTimePoint) override;
-        int GetTickOrder() override;
+        // FrameStageHandler interface
+        void OnFrameStage(const FrameStage stage, const float deltaTime) override;
 
         // NetworkFPCControllerNotificationBus
         void OnNetworkTickStart(const float deltaTime, const bool server, const AZ::EntityId& entityId);
@@ -163,7 +164,8 @@ namespace FirstPersonController
 
         // Change the camera field of view when sprinting
         void PerformSprintFoV(const float deltaTime);
-        bool GetSprinting();
+        void UpdateSprintingObstructed();
+        bool GetSprinting() const;
 
         // Jump Head Tilt
         void PerformJumpHeadTilt(const float deltaTime);
@@ -207,6 +209,12 @@ namespace FirstPersonController
         bool m_sprintFoVEnabled = true;
         bool m_sprintingObstructedCheck[16] = {};
         AZ::u8 m_sprintingObstructedIndex = 0;
+        // Number of set entries in m_sprintingObstructedCheck, and whether all of them are set as of the last update
+        AZ::u8 m_sprintingObstructedCount = 0;
+        bool m_sprintingObstructed = false;
+        // The FoV last written to the camera, a change smaller than the epsilon isn't written
+        static constexpr float SprintFoVEpsilon = 0.001f;
+        float m_appliedFoV = -1.f;
         float m_sprintFoVTimeAccumulator = 0.f;
         float m_sprintFoVLerpTime = 0.5f;
         float m_sprintFoV = 90.f;
@@ -254,19 +262,29 @@ namespace FirstPersonController
         float CalculateHeadbobVerticalShape(const float phase) const;
         float CalculateHeadbobHorizontalShape(const float phase) const;
         float CalculateHeadbobForwardShape(const float phase) const;
-        void UpdateHeadbobShapePeaks();
+        // One walk cycle of each waveform, baked whenever the shaping values change. A power of two so the index wraps with a mask
+        static constexpr AZ::u32 HeadbobShapeTableSamples = 256;
+        using HeadbobShapeTable = AZStd::array<float, HeadbobShapeTableSamples>;
+        static float SampleHeadbobShapeTable(const HeadbobShapeTable& table, const float phase);
+        HeadbobShapeTable m_headbobVerticalShapeTable = {};
+        HeadbobShapeTable m_headbobHorizontalShapeTable = {};
+        HeadbobShapeTable m_headbobForwardShapeTable = {};
+        HeadbobShapeTable m_headbobSineTable = {};
+        void UpdateHeadbobShapeTables();
         AZ::u32 OnHeadbobRealismChanged();
         bool GetHeadbobEnabledAndRealismGreaterThanZero() const;
+        CameraPoseCompositor& GetHeadbobCameraPose();
         AZ::Vector3 m_cameraTranslationWithoutHeadbob = AZ::Vector3::CreateZero();
         AZ::Vector3 m_originalCameraTranslation = AZ::Vector3::CreateZero();
         AZ::Vector3 m_headbobOffset = AZ::Vector3::CreateZero();
         AZ::Vector3 m_prevHeadbobOffset = AZ::Vector3::CreateZero();
         AZ::Vector3 m_smoothedHeadbobOffset = AZ::Vector3::CreateZero();
         AZ::Quaternion m_headbobRotationOffset = AZ::Quaternion::CreateIdentity();
-        AZ::Quaternion m_prevHeadbobRotationOffset = AZ::Quaternion::CreateIdentity();
         AZ::Quaternion m_smoothedHeadbobRotationOffset = AZ::Quaternion::CreateIdentity();
         AZ::EntityId m_cameraEntityId = AZ::EntityId();
         AZ::Entity* m_cameraEntityPtr = nullptr;
+        // Used when the headbob camera isn't the one the First Person Controller drives
+        CameraPoseCompositor m_headbobCameraPose;
 
         // FirstPersonController event value multipliers
         float* m_jumpValue = nullptr;
@@ -286,6 +304,9 @@ namespace FirstPersonController
         // Map of event IDs and event value multipliers
         AZStd::map<StartingPointInput::InputEventNotificationId*, float*> m_controlMap = { { &m_interactEventId, &m_interactValue } };
 
+        // Event IDs resolved from m_controlMap in AssignConnectInputEvents, looked up on each input notification
+        InputEventDispatchTable m_inputDispatchTable;
+
         // FirstPersonControllerComponentNotificationBus
         void OnPhysicsTimestepStart(const float timeStep, const AZ::EntityId& entityId);
         void OnPhysicsTimestepFinish(const float timeStep, const AZ::EntityId& entityId);
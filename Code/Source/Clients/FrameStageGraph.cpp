@@ -0,0 +1,125 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Clients/FrameStageGraph.h>
+
+#include <AzCore/std/algorithm.h>
+
+namespace FirstPersonController
+{
+    FrameStageHandler::~FrameStageHandler()
+    {
+        FrameStageDisconnect();
+    }
+
+    void FrameStageHandler::FrameStageConnect(const FrameStage stage)
+    {
+        FrameStageDisconnect();
+        if (auto* fpcSystem = FirstPersonControllerInterface::Get())
+        {
+            fpcSystem->AddFrameStageHandler(stage, this);
+            m_frameStage = stage;
+        }
+    }
+
+    void FrameStageHandler::FrameStageDisconnect()
+    {
+        if (!IsFrameStageConnected())
+            return;
+
+        if (auto* fpcSystem = FirstPersonControllerInterface::Get())
+            fpcSystem->RemoveFrameStageHandler(m_frameStage, this);
+        m_frameStage = FrameStage::Count;
+    }
+
+    bool FrameStageHandler::IsFrameStageConnected() const
+    {
+        return m_frameStage != FrameStage::Count;
+    }
+
+    void FrameStageGraph::Add(const FrameStage stage, FrameStageHandler* handler)
+    {
+        if (stage == FrameStage::Count || handler == nullptr)
+            return;
+
+        AZStd::vector<FrameStageHandler*>& handlers = m_handlers[static_cast<size_t>(stage)];
+        if (AZStd::find(handlers.begin(), handlers.end(), handler) == handlers.end())
+            handlers.push_back(handler);
+    }
+
+    void FrameStageGraph::Remove(const FrameStage stage, FrameStageHandler* handler)
+    {
+        if (stage == FrameStage::Count)
+            return;
+
+        AZStd::vector<FrameStageHandler*>& handlers = m_handlers[static_cast<size_t>(stage)];
+        auto it = AZStd::find(handlers.begin(), handlers.end(), handler);
+        if (it == handlers.end())
+            return;
+
+        if (m_executing)
+        {
+            *it = nullptr;
+            m_removedWhileExecuting = true;
+        }
+        else
+            handlers.erase(it);
+    }
+
+    void FrameStageGraph::Execute(const float deltaTime)
+    {
+        m_executing = true;
+        for (size_t stageIndex = 0; stageIndex < m_handlers.size(); ++stageIndex)
+        {
+            const FrameStage stage = static_cast<FrameStage>(stageIndex);
+            for (size_t handlerIndex = 0; handlerIndex < m_handlers[stageIndex].size(); ++handlerIndex)
+            {
+                if (FrameStageHandler* handler = m_handlers[stageIndex][handlerIndex])
+                    handler->QueueFrameStageQueries(stage, m_sceneQueryBatch);
+            }
+            m_sceneQueryBatch.Submit();
+
+            // Indexed, since a handler may add another to the stage that is running
+            for (size_t handlerIndex = 0; handlerIndex < m_handlers[stageIndex].size(); ++handlerIndex)
+            {
+                if (FrameStageHandler* handler = m_handlers[stageIndex][handlerIndex])
+                    handler->OnFrameStage(stage, deltaTime);
+            }
+            m_sceneQueryBatch.Clear();
+        }
+        m_executing = false;
+
+        if (!m_removedWhileExecuting)
+            return;
+        m_removedWhileExecuting = false;
+
+        for (AZStd::vector<FrameStageHandler*>& handlers : m_handlers)
+            handlers.erase(AZStd::remove(handlers.begin(), handlers.end(), nullptr), handlers.end());
+    }
+
+    void FrameStageGraph::BeginTickStage(const TickStage stage, const AZ::u64 tickId)
+    {
+        if (stage == TickStage::Count || m_tickStageIds[static_cast<size_t>(stage)] == tickId)
+            return;
+        m_tickStageIds[static_cast<size_t>(stage)] = tickId;
+
+        SceneQueryBatch& batch = m_tickStageQueryBatches[static_cast<size_t>(stage)];
+        batch.Clear();
+        for (const AZStd::vector<FrameStageHandler*>& handlers : m_handlers)
+        {
+            for (FrameStageHandler* handler : handlers)
+            {
+                if (handler != nullptr)
+                    handler->QueueTickStageQueries(stage, batch);
+            }
+        }
+        batch.Submit();
+    }
+
+    void FrameStageGraph::EndTickStage(const TickStage stage)
+    {
+        if (stage != TickStage::Count)
+            m_tickStageQueryBatches[static_cast<size_t>(stage)].Clear();
+    }
+} // namespace FirstPersonController
@@ -0,0 +1,68 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <FirstPersonController/FirstPersonControllerBus.h>
+
+#include <Clients/SceneQueryBatch.h>
+
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+
+namespace FirstPersonController
+{
+    // Runs in one stage of the frame, connected and disconnected in the same way as a TickBus handler
+    class FrameStageHandler
+    {
+    public:
+        virtual ~FrameStageHandler();
+
+        virtual void OnFrameStage(const FrameStage stage, const float deltaTime) = 0;
+        // Queues the scene queries the handler will make in the stage, run in one batch with the other handlers' before it starts
+        virtual void QueueFrameStageQueries([[maybe_unused]] const FrameStage stage, [[maybe_unused]] SceneQueryBatch& batch)
+        {
+        }
+        // Queues the scene queries the handler will make when it next runs the tick stage, run in one batch with the other
+        // handlers' by the first of them to start it
+        virtual void QueueTickStageQueries([[maybe_unused]] const TickStage stage, [[maybe_unused]] SceneQueryBatch& batch)
+        {
+        }
+
+        // Connecting again moves the handler to the end of the stage, or to another stage
+        void FrameStageConnect(const FrameStage stage);
+        void FrameStageDisconnect();
+        bool IsFrameStageConnected() const;
+
+    private:
+        FrameStage m_frameStage = FrameStage::Count;
+    };
+
+    // Runs each stage for every handler before moving on to the next, so everything that follows the camera sees the pose
+    // written for this frame rather than the last one
+    class FrameStageGraph
+    {
+    public:
+        void Add(const FrameStage stage, FrameStageHandler* handler);
+        void Remove(const FrameStage stage, FrameStageHandler* handler);
+
+        void Execute(const float deltaTime);
+
+        // Queues and submits every handler's queries for the tick stage, unless they were already submitted for this tick
+        void BeginTickStage(const TickStage stage, const AZ::u64 tickId);
+        // Clears the tick stage's batch once no handler will take from it
+        void EndTickStage(const TickStage stage);
+
+    private:
+        // Handlers removed while a stage runs are only cleared then, and compacted once it's done
+        AZStd::array<AZStd::vector<FrameStageHandler*>, static_cast<size_t>(FrameStage::Count)> m_handlers;
+        SceneQueryBatch m_sceneQueryBatch;
+        AZStd::array<SceneQueryBatch, static_cast<size_t>(TickStage::Count)> m_tickStageQueryBatches;
+        static constexpr AZ::u64 NoTickId = AZStd::numeric_limits<AZ::u64>::max();
+        AZStd::array<AZ::u64, static_cast<size_t>(TickStage::Count)> m_tickStageIds = { NoTickId, NoTickId };
+        bool m_executing = false;
+        bool m_removedWhileExecuting = false;
+    };
+} // namespace FirstPersonController
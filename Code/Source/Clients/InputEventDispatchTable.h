@@ -0,0 +1,53 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/std/containers/unordered_map.h>
+
+#include <StartingPointInput/InputEventNotificationBus.h>
+
+namespace FirstPersonController
+{
+    // Maps the input event IDs resolved in AssignConnectInputEvents straight to the value each event writes, so an input
+    // notification costs one hashed lookup instead of a scan over every event ID
+    class InputEventDispatchTable
+    {
+    public:
+        void Clear()
+        {
+            m_slots.clear();
+        }
+
+        void Add(const StartingPointInput::InputEventNotificationId& inputId, float* value)
+        {
+            m_slots[MakeKey(inputId)] = value;
+        }
+
+        // Returns the value slot of the input event, or nullptr when the event was never added
+        float* Find(const StartingPointInput::InputEventNotificationId& inputId) const
+        {
+            const auto it = m_slots.find(MakeKey(inputId));
+            return it != m_slots.end() ? it->second : nullptr;
+        }
+
+        // Writes the value to the input event's slot, returning false when the event was never added
+        bool Write(const StartingPointInput::InputEventNotificationId& inputId, const float value) const
+        {
+            float* slot = Find(inputId);
+            if (slot == nullptr)
+                return false;
+            *slot = value;
+            return true;
+        }
+
+    private:
+        static AZ::u64 MakeKey(const StartingPointInput::InputEventNotificationId& inputId)
+        {
+            return (static_cast<AZ::u64>(inputId.m_localUserId) << 32) | static_cast<AZ::u32>(inputId.m_actionNameCrc);
+        }
+
+        AZStd::unordered_map<AZ::u64, float*> m_slots;
+    };
+} // namespace FirstPersonController
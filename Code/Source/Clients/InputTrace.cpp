@@ -0,0 +1,199 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Clients/InputTrace.h>
+
+#include <AzCore/std/algorithm.h>
+
+namespace FirstPersonController
+{
+    InputTrace::~InputTrace()
+    {
+        Stop();
+    }
+
+    bool InputTrace::StartRecording(const char* path)
+    {
+        Stop();
+        if (!m_file.Open(
+                path, AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+            return false;
+
+        m_mode = Mode::Recording;
+        m_buffer.reserve(BufferSize);
+        for (InputTraceRecord& previous : m_previous)
+            previous = InputTraceRecord();
+
+        Write(&FileMagic, sizeof(FileMagic));
+        Write(&FileVersion, sizeof(FileVersion));
+        return true;
+    }
+
+    void InputTrace::Record(const InputTraceRecord& record)
+    {
+        if (m_mode != Mode::Recording || record.m_tickTimestepNetwork >= TickTypeCount)
+            return;
+
+        InputTraceRecord& previous = m_previous[record.m_tickTimestepNetwork];
+
+        // Bit 0 marks a changed delta time, the following bits the changed input values
+        AZ::u16 changedMask = record.m_deltaTime != previous.m_deltaTime ? 1 : 0;
+        for (size_t i = 0; i < InputTraceRecord::ValueCount; ++i)
+            if (record.m_values[i] != previous.m_values[i])
+                changedMask |= static_cast<AZ::u16>(1 << (i + 1));
+
+        Write(&record.m_tickTimestepNetwork, sizeof(record.m_tickTimestepNetwork));
+        Write(&changedMask, sizeof(changedMask));
+        if (changedMask & 1)
+            Write(&record.m_deltaTime, sizeof(record.m_deltaTime));
+        for (size_t i = 0; i < InputTraceRecord::ValueCount; ++i)
+            if (changedMask & (1 << (i + 1)))
+                Write(&record.m_values[i], sizeof(float));
+
+        previous = record;
+    }
+
+    bool InputTrace::StartReplay(const char* path)
+    {
+        Stop();
+        if (!m_file.Open(path, AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+            return false;
+
+        m_mode = Mode::Replaying;
+        m_buffer.clear();
+        m_readOffset = 0;
+        for (size_t i = 0; i < TickTypeCount; ++i)
+        {
+            m_previous[i] = InputTraceRecord();
+            m_previous[i].m_tickTimestepNetwork = static_cast<AZ::u8>(i);
+            m_pending[i].m_records.resize(PendingRecordsMax);
+            m_pending[i].m_front = 0;
+            m_pending[i].m_count = 0;
+        }
+        m_pendingDropped = 0;
+
+        AZ::u32 magic = 0, version = 0;
+        if (!Read(&magic, sizeof(magic)) || !Read(&version, sizeof(version)) || magic != FileMagic || version != FileVersion)
+        {
+            AZ_Warning("First Person Controller Component", false, "%s is not a compatible input trace.", path);
+            Stop();
+            return false;
+        }
+        return true;
+    }
+
+    bool InputTrace::Replay(const AZ::u8 tickTimestepNetwork, InputTraceRecord& record)
+    {
+        if (m_mode != Mode::Replaying || tickTimestepNetwork >= TickTypeCount)
+            return false;
+
+        PendingRecords& pending = m_pending[tickTimestepNetwork];
+        while (pending.m_count == 0)
+            if (!DecodeNext())
+                return false;
+
+        record = pending.m_records[pending.m_front];
+        pending.m_front = (pending.m_front + 1) % pending.m_records.size();
+        --pending.m_count;
+        return true;
+    }
+
+    void InputTrace::Stop()
+    {
+        if (m_mode == Mode::Recording)
+            Flush();
+        if (m_mode != Mode::None)
+            m_file.Close();
+
+        AZ_Warning(
+            "First Person Controller Component",
+            m_pendingDropped == 0,
+            "%zu replayed input records were dropped, their tick type wasn't replayed.",
+            m_pendingDropped);
+
+        m_mode = Mode::None;
+        m_buffer.clear();
+        m_buffer.shrink_to_fit();
+        m_readOffset = 0;
+        for (PendingRecords& pending : m_pending)
+            pending = {};
+        m_pendingDropped = 0;
+    }
+
+    bool InputTrace::IsRecording() const
+    {
+        return m_mode == Mode::Recording;
+    }
+
+    bool InputTrace::IsReplaying() const
+    {
+        return m_mode == Mode::Replaying;
+    }
+
+    void InputTrace::Write(const void* data, const size_t size)
+    {
+        if (m_buffer.size() + size > BufferSize)
+            Flush();
+        const AZ::u8* bytes = static_cast<const AZ::u8*>(data);
+        m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+    }
+
+    void InputTrace::Flush()
+    {
+        if (!m_buffer.empty())
+            m_file.Write(m_buffer.data(), m_buffer.size());
+        m_buffer.clear();
+    }
+
+    bool InputTrace::Read(void* data, const size_t size)
+    {
+        AZ::u8* bytes = static_cast<AZ::u8*>(data);
+        size_t copied = 0;
+        while (copied < size)
+        {
+            if (m_readOffset == m_buffer.size())
+            {
+                m_buffer.resize_no_construct(BufferSize);
+                m_buffer.resize(m_file.Read(BufferSize, m_buffer.data()));
+                m_readOffset = 0;
+                if (m_buffer.empty())
+                    return false;
+            }
+            const size_t count = AZStd::min(size - copied, m_buffer.size() - m_readOffset);
+            memcpy(bytes + copied, m_buffer.data() + m_readOffset, count);
+            m_readOffset += count;
+            copied += count;
+        }
+        return true;
+    }
+
+    bool InputTrace::DecodeNext()
+    {
+        AZ::u8 tickTimestepNetwork = 0;
+        AZ::u16 changedMask = 0;
+        if (!Read(&tickTimestepNetwork, sizeof(tickTimestepNetwork)) || tickTimestepNetwork >= TickTypeCount ||
+            !Read(&changedMask, sizeof(changedMask)))
+            return false;
+
+        InputTraceRecord record = m_previous[tickTimestepNetwork];
+        if ((changedMask & 1) && !Read(&record.m_deltaTime, sizeof(record.m_deltaTime)))
+            return false;
+        for (size_t i = 0; i < InputTraceRecord::ValueCount; ++i)
+            if ((changedMask & (1 << (i + 1))) && !Read(&record.m_values[i], sizeof(float)))
+                return false;
+
+        m_previous[tickTimestepNetwork] = record;
+
+        PendingRecords& pending = m_pending[tickTimestepNetwork];
+        if (pending.m_count == pending.m_records.size())
+        {
+            pending.m_front = (pending.m_front + 1) % pending.m_records.size();
+            --pending.m_count;
+            ++m_pendingDropped;
+        }
+        pending.m_records[(pending.m_front + pending.m_count) % pending.m_records.size()] = record;
+        ++pending.m_count;
+        return true;
+    }
+} // namespace FirstPersonController
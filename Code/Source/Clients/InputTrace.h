@@ -0,0 +1,82 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace FirstPersonController
+{
+    // The input values and delta time that drive one First Person Controller tick
+    struct InputTraceRecord
+    {
+        // Forward, back, left, right, yaw, pitch, sprint, effective sprint, sprint acceleration, crouch and jump
+        static constexpr size_t ValueCount = 11;
+
+        // Frame tick == 0, physics fixed timestep == 1, network tick == 2
+        AZ::u8 m_tickTimestepNetwork = 0;
+        float m_deltaTime = 0.f;
+        float m_values[ValueCount] = {};
+    };
+
+    // Compact binary trace of a character's per-tick inputs, for replaying a recorded session exactly in headless performance runs.
+    // Each record only stores the fields that changed since the previous record of the same tick type, and the file is written
+    // and read through a fixed size buffer so that long sessions use bounded memory.
+    class InputTrace
+    {
+    public:
+        ~InputTrace();
+
+        bool StartRecording(const char* path);
+        void Record(const InputTraceRecord& record);
+
+        bool StartReplay(const char* path);
+        // Fills the next recorded record of the tick type, returns false once the trace has none left
+        bool Replay(const AZ::u8 tickTimestepNetwork, InputTraceRecord& record);
+
+        // Ends recording or replay, flushing any buffered records to the file
+        void Stop();
+
+        bool IsRecording() const;
+        bool IsReplaying() const;
+
+    private:
+        static constexpr AZ::u32 FileMagic = 0x49435046; // "FPCI"
+        static constexpr AZ::u32 FileVersion = 1;
+        static constexpr size_t BufferSize = 64 * 1024;
+        static constexpr size_t TickTypeCount = 3;
+
+        void Write(const void* data, const size_t size);
+        void Flush();
+        bool Read(void* data, const size_t size);
+        bool DecodeNext();
+
+        enum class Mode : AZ::u8
+        {
+            None,
+            Recording,
+            Replaying
+        };
+        Mode m_mode = Mode::None;
+
+        AZ::IO::SystemFile m_file;
+        AZStd::vector<AZ::u8> m_buffer;
+        size_t m_readOffset = 0;
+
+        // The previous record of each tick type that the next one is encoded against
+        InputTraceRecord m_previous[TickTypeCount];
+        // Records decoded while seeking one of another tick type, in a ring per tick type that's allocated when replay starts and
+        // drops the oldest record when a tick type isn't being replayed
+        static constexpr size_t PendingRecordsMax = 256;
+        struct PendingRecords
+        {
+            AZStd::vector<InputTraceRecord> m_records;
+            size_t m_front = 0;
+            size_t m_count = 0;
+        };
+        PendingRecords m_pending[TickTypeCount];
+        size_t m_pendingDropped = 0;
+    };
+} // namespace FirstPersonController
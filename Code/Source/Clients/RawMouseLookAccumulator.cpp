@@ -0,0 +1,84 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Clients/RawMouseLookAccumulator.h>
+
+#include <AzCore/Math/MathUtils.h>
+
+namespace FirstPersonController
+{
+    void RawMouseLookAccumulator::AddSample(const AZ::s64 timeUs, const float yaw, const float pitch)
+    {
+        if (m_samples.empty())
+        {
+            // A sample arriving after an idle period only covers the time since the mouse moved
+            m_startTimeUs = timeUs;
+            m_samples.push_back({ timeUs, yaw, pitch });
+            return;
+        }
+
+        Sample& newest = m_samples.back();
+        if (timeUs <= newest.m_timeUs)
+        {
+            newest.m_yaw += yaw;
+            newest.m_pitch += pitch;
+            return;
+        }
+
+        // Fold the oldest samples together rather than dropping mouse movement when nothing consumes them
+        if (m_samples.size() >= MaxSamples)
+        {
+            Sample oldest = m_samples.front();
+            m_samples.pop_front();
+            m_startTimeUs = oldest.m_timeUs;
+            m_samples.front().m_yaw += oldest.m_yaw;
+            m_samples.front().m_pitch += oldest.m_pitch;
+        }
+
+        m_samples.push_back({ timeUs, yaw, pitch });
+    }
+
+    bool RawMouseLookAccumulator::Consume(
+        const AZ::s64 untilTimeUs, const bool interpolate, float& yaw, float& pitch, AZ::s64& oldestTimeUs)
+    {
+        yaw = 0.f;
+        pitch = 0.f;
+        oldestTimeUs = m_startTimeUs;
+        bool consumed = false;
+
+        while (!m_samples.empty() && m_samples.front().m_timeUs <= untilTimeUs)
+        {
+            yaw += m_samples.front().m_yaw;
+            pitch += m_samples.front().m_pitch;
+            m_startTimeUs = m_samples.front().m_timeUs;
+            m_samples.pop_front();
+            consumed = true;
+        }
+
+        if (interpolate && !m_samples.empty() && untilTimeUs > m_startTimeUs)
+        {
+            Sample& spanning = m_samples.front();
+            const float fraction = AZ::GetClamp(
+                static_cast<float>(untilTimeUs - m_startTimeUs) / static_cast<float>(spanning.m_timeUs - m_startTimeUs), 0.f, 1.f);
+            yaw += spanning.m_yaw * fraction;
+            pitch += spanning.m_pitch * fraction;
+            spanning.m_yaw -= spanning.m_yaw * fraction;
+            spanning.m_pitch -= spanning.m_pitch * fraction;
+            m_startTimeUs = untilTimeUs;
+            consumed = true;
+        }
+
+        return consumed;
+    }
+
+    void RawMouseLookAccumulator::Clear()
+    {
+        m_samples.clear();
+    }
+
+    bool RawMouseLookAccumulator::IsEmpty() const
+    {
+        return m_samples.empty();
+    }
+} // namespace FirstPersonController
@@ -0,0 +1,42 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/deque.h>
+
+namespace FirstPersonController
+{
+    // Timestamped raw mouse deltas collected between ticks. Each sample covers the time since the sample before it, so a consumer
+    // that stops at a time between two samples can take the elapsed fraction of the later one and leave the rest for the next tick.
+    class RawMouseLookAccumulator
+    {
+    public:
+        static constexpr size_t MaxSamples = 512;
+
+        // Samples with the same timestamp are merged, so the X and Y events of one mouse report become a single sample
+        void AddSample(const AZ::s64 timeUs, const float yaw, const float pitch);
+
+        // Sums the deltas of every sample up to the time. With interpolation the sample spanning the time is split at it, otherwise
+        // it is left whole for the next call. Returns false when nothing was consumed, oldestTimeUs is the time of the first input
+        // that contributed to the sums.
+        bool Consume(const AZ::s64 untilTimeUs, const bool interpolate, float& yaw, float& pitch, AZ::s64& oldestTimeUs);
+
+        void Clear();
+        bool IsEmpty() const;
+
+    private:
+        struct Sample
+        {
+            AZ::s64 m_timeUs = 0;
+            float m_yaw = 0.f;
+            float m_pitch = 0.f;
+        };
+
+        AZStd::deque<Sample> m_samples;
+        // Start of the time covered by the oldest sample
+        AZ::s64 m_startTimeUs = 0;
+    };
+} // namespace FirstPersonController
@@ -0,0 +1,62 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Clients/SceneQueryBatch.h>
+
+#include <AzCore/Interface/Interface.h>
+
+#include <AzFramework/Physics/PhysicsScene.h>
+
+namespace FirstPersonController
+{
+    SceneQueryBatch::Ticket SceneQueryBatch::Queue(AZStd::shared_ptr<AzPhysics::SceneQueryRequest> request)
+    {
+        if (m_submitted || request == nullptr)
+            return InvalidTicket;
+
+        m_requests.push_back(AZStd::move(request));
+        return static_cast<Ticket>(m_requests.size() - 1);
+    }
+
+    void SceneQueryBatch::Submit()
+    {
+        if (m_submitted || m_requests.empty())
+            return;
+        m_submitted = true;
+
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        if (sceneInterface == nullptr)
+            return;
+
+        const AzPhysics::SceneHandle sceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
+        if (sceneHandle != AzPhysics::InvalidSceneHandle)
+            m_hits = sceneInterface->QuerySceneBatch(sceneHandle, m_requests);
+    }
+
+    bool SceneQueryBatch::Take(const Ticket ticket, AzPhysics::SceneQueryHits& hits)
+    {
+        if (!m_submitted || ticket >= m_hits.size())
+            return false;
+
+        hits = AZStd::move(m_hits[ticket]);
+        return true;
+    }
+
+    void SceneQueryBatch::Clear()
+    {
+        m_requests.clear();
+        m_hits.clear();
+        m_submitted = false;
+    }
+
+    bool SceneQueryBatch::IsEmpty() const
+    {
+        return m_requests.empty();
+    }
+
+    size_t SceneQueryBatch::GetSize() const
+    {
+        return m_requests.size();
+    }
+} // namespace FirstPersonController
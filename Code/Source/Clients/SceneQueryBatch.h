@@ -0,0 +1,37 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/std/limits.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+#include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
+
+namespace FirstPersonController
+{
+    // Scene queries queued by several characters, run in the default physics scene with a single QuerySceneBatch call so the
+    // per-query setup and scene locking is paid once
+    class SceneQueryBatch
+    {
+    public:
+        using Ticket = AZ::u32;
+        static constexpr Ticket InvalidTicket = AZStd::numeric_limits<Ticket>::max();
+
+        // Returns the ticket that the request's hits are taken with once the batch has been submitted
+        Ticket Queue(AZStd::shared_ptr<AzPhysics::SceneQueryRequest> request);
+        void Submit();
+        // Moves out the hits of a submitted request, returning false if the ticket isn't part of the batch
+        bool Take(const Ticket ticket, AzPhysics::SceneQueryHits& hits);
+        void Clear();
+
+        bool IsEmpty() const;
+        size_t GetSize() const;
+
+    private:
+        AzPhysics::SceneQueryRequests m_requests;
+        AzPhysics::SceneQueryHitsList m_hits;
+        bool m_submitted = false;
+    };
+} // namespace FirstPersonController
@@ -4,8 +4,13 @@
 
 #include <Multiplayer/NetworkFPC.h>
 
+#include <FirstPersonController/NetworkFPCBus.h>
+
+#include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 
 #include <Multiplayer/Components/NetworkCharacterComponent.h>
 #include <Multiplayer/Components/NetworkTransformComponent.h>
@@ -34,6 +39,267 @@ namespace FirstPersonController
         AZ::ConsoleFunctorFlags::Null,
         "The tolerance used for ground obstruction checks, set this to a large number to avoid false-positive checks");
 
+    // Every NetworkFPC network property as X(Name, Rewindable, PerTickState, FromAutonomous), in NetworkFPC.AutoComponent.xml order.
+    // The names are checked against the generated accessors, and the counts against the XML, at compile time
+#define NETWORKFPC_NETWORK_PROPERTIES(X)                                                                                                   \
+    X(EnableNetworkFPC, false, false, false)                                                                                               \
+    X(ServerFPCEntityId, false, false, false)                                                                                              \
+    X(IsNetBot, false, false, false)                                                                                                       \
+    X(LookRotationDelta, true, true, false)                                                                                                \
+    X(LookRotationDeltaQuat, true, true, false)                                                                                            \
+    X(DesiredVelocity, true, true, false)                                                                                                  \
+    X(CorrectedVelocityXY, true, true, true)                                                                                               \
+    X(CorrectedVelocityXYRelay, false, true, false)                                                                                        \
+    X(ApplyVelocityXY, true, true, false)                                                                                                  \
+    X(ApplyVelocityZ, true, true, false)                                                                                                   \
+    X(VelocityFromImpulse, true, true, false)                                                                                              \
+    X(CurrentTransform, true, true, false)                                                                                                 \
+    X(OverrideTransformForTick, true, true, false)                                                                                         \
+    X(OverrideRotationForTick, true, true, false)                                                                                          \
+    X(OverrideTransform, true, true, false)                                                                                                \
+    X(TopWalkSpeed, true, true, false)                                                                                                     \
+    X(StaminaPercentage, true, true, false)                                                                                                \
+    X(SprintRegenRate, true, true, false)                                                                                                  \
+    X(SprintMaxTime, true, true, false)                                                                                                    \
+    X(SprintCooldownTime, true, true, false)                                                                                               \
+    X(SprintCooldownTimer, true, true, false)                                                                                              \
+    X(JumpInitialVelocity, true, true, false)                                                                                              \
+    X(EnableNetworkAnimation, false, false, false)                                                                                         \
+    X(IsSprinting, true, true, true)                                                                                                       \
+    X(IsSprintingRelay, false, true, false)                                                                                                \
+    X(IsCrouchingDownMove, true, true, false)                                                                                              \
+    X(IsCrouching, true, true, false)                                                                                                      \
+    X(IsStandingUpMove, true, true, false)                                                                                                 \
+    X(IsJumpStarting, true, true, false)                                                                                                   \
+    X(IsFalling, true, true, false)                                                                                                        \
+    X(IsLanding, true, true, false)                                                                                                        \
+    X(IsGrounded, true, true, false)                                                                                                       \
+    X(PlayerStringNetEntityIds, false, false, false)                                                                                       \
+    X(BotStringNetEntityIds, false, false, false)                                                                                          \
+    X(ChildParentStringNetEntityId, false, false, false)
+
+#define NETWORKFPC_PROPERTY_TYPE(NAME) AZStd::remove_cvref_t<decltype(AZStd::declval<const NetworkFPCBase&>().Get##NAME())>
+
+    struct NetworkFPCPropertyBudget
+    {
+        const char* m_name;
+        size_t m_size;
+        bool m_rewindable;
+        bool m_perTickState;
+    };
+
+    static constexpr NetworkFPCPropertyBudget NetworkFPCPropertyBudgets[] = {
+#define NETWORKFPC_PROPERTY_BUDGET(NAME, REWINDABLE, PER_TICK_STATE, FROM_AUTONOMOUS)                                                      \
+    { #NAME, sizeof(NETWORKFPC_PROPERTY_TYPE(NAME)), REWINDABLE, PER_TICK_STATE },
+        NETWORKFPC_NETWORK_PROPERTIES(NETWORKFPC_PROPERTY_BUDGET)
+#undef NETWORKFPC_PROPERTY_BUDGET
+    };
+
+    static constexpr size_t GetRewindableNetworkFPCPropertyCount()
+    {
+        size_t count = 0;
+        for (const NetworkFPCPropertyBudget& property : NetworkFPCPropertyBudgets)
+            if (property.m_rewindable)
+                ++count;
+        return count;
+    }
+
+#if defined(NETWORKFPC_NETWORK_PROPERTY_COUNT) && defined(NETWORKFPC_REWINDABLE_NETWORK_PROPERTY_COUNT)
+    static_assert(
+        AZStd::size(NetworkFPCPropertyBudgets) == NETWORKFPC_NETWORK_PROPERTY_COUNT,
+        "NETWORKFPC_NETWORK_PROPERTIES is out of sync with the network properties in NetworkFPC.AutoComponent.xml");
+    static_assert(
+        GetRewindableNetworkFPCPropertyCount() == NETWORKFPC_REWINDABLE_NETWORK_PROPERTY_COUNT,
+        "NETWORKFPC_NETWORK_PROPERTIES is out of sync with the rewindable properties in NetworkFPC.AutoComponent.xml");
+#endif
+
+    // Reports the rewind history memory held per NetworkFPC entity and the per-tick history copy cost of each property
+    static void net_FPCRewindAudit([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        AZ::EBusAggregateResults<AZ::EntityId> characterEntityIds;
+        FirstPersonControllerComponentRequestBus::BroadcastResult(
+            characterEntityIds, &FirstPersonControllerComponentRequestBus::Events::GetCharacterEntityId);
+
+        size_t networkFPCEntityCount = 0;
+        for (const AZ::EntityId& characterEntityId : characterEntityIds.values)
+        {
+            const AZ::Entity* characterEntity = AZ::Interface<AZ::ComponentApplicationRequests>::Get()->FindEntity(characterEntityId);
+            if (characterEntity != nullptr && characterEntity->FindComponent<NetworkFPC>() != nullptr)
+                ++networkFPCEntityCount;
+        }
+
+        AZ_Printf("NetworkFPC", "%-28s %10s %12s %14s", "Property", "Rewindable", "Bytes/Tick", "History Bytes");
+        size_t totalTickBytes = 0;
+        size_t totalHistoryBytes = 0;
+        for (const NetworkFPCPropertyBudget& property : NetworkFPCPropertyBudgets)
+        {
+            if (!property.m_perTickState)
+                continue;
+            const size_t tickBytes = property.m_rewindable ? property.m_size : 0;
+            const size_t historyBytes = tickBytes * Multiplayer::RewindHistorySize;
+            totalTickBytes += tickBytes;
+            totalHistoryBytes += historyBytes;
+            AZ_Printf(
+                "NetworkFPC",
+                "%-28s %10s %12zu %14zu",
+                property.m_name,
+                property.m_rewindable ? "true" : "false",
+                tickBytes,
+                historyBytes);
+        }
+        AZ_Printf("NetworkFPC", "Per entity: %zu bytes copied per tick, %zu bytes of rewind history", totalTickBytes, totalHistoryBytes);
+        AZ_Printf(
+            "NetworkFPC",
+            "%zu NetworkFPC entities: %zu bytes copied per tick, %zu bytes of rewind history",
+            networkFPCEntityCount,
+            networkFPCEntityCount * totalTickBytes,
+            networkFPCEntityCount * totalHistoryBytes);
+    }
+    AZ_CONSOLEFREEFUNC(
+        net_FPCRewindAudit,
+        AZ::ConsoleFunctorFlags::Null,
+        "Reports the rewind history memory and per-tick history copy cost of each NetworkFPC property");
+
+    // Reports the magnitude of the corrections applied to each autonomous NetworkFPC character
+    static void net_FPCCorrectionStats([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        AZ::EBusAggregateResults<AZ::EntityId> characterEntityIds;
+        FirstPersonControllerComponentRequestBus::BroadcastResult(
+            characterEntityIds, &FirstPersonControllerComponentRequestBus::Events::GetCharacterEntityId);
+
+        for (const AZ::EntityId& characterEntityId : characterEntityIds.values)
+        {
+            AZ::Entity* characterEntity = AZ::Interface<AZ::ComponentApplicationRequests>::Get()->FindEntity(characterEntityId);
+            if (characterEntity == nullptr || characterEntity->FindComponent<NetworkFPC>() == nullptr)
+                continue;
+            const FirstPersonControllerComponent* firstPersonController = characterEntity->FindComponent<FirstPersonControllerComponent>();
+            if (firstPersonController == nullptr || firstPersonController->GetCorrectionStats().m_count == 0)
+                continue;
+            const FirstPersonControllerCorrectionStats& stats = firstPersonController->GetCorrectionStats();
+            AZ_Printf(
+                "NetworkFPC",
+                "%s: %u corrections (%u snapped), magnitude mean %.4f m, max %.4f m, last %.4f m",
+                characterEntity->GetName().c_str(),
+                stats.m_count,
+                stats.m_snapCount,
+                stats.m_magnitudeSum / stats.m_count,
+                stats.m_magnitudeMax,
+                stats.m_magnitudeLast);
+        }
+    }
+    AZ_CONSOLEFREEFUNC(
+        net_FPCCorrectionStats,
+        AZ::ConsoleFunctorFlags::Null,
+        "Reports the count and magnitude of the corrections applied to autonomous NetworkFPC characters");
+
+    AZ_CVAR(
+        bool,
+        net_FPCPropertyStatsEnabled,
+        false,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "Records the updates and size of each NetworkFPC property sent and network input received on each server connection");
+
+    static void net_FPCPropertyStats([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        NetworkFPCRequestBus::Broadcast(&NetworkFPCRequestBus::Events::DumpNetworkFPCPropertyStats);
+    }
+    AZ_CONSOLEFREEFUNC(
+        net_FPCPropertyStats,
+        AZ::ConsoleFunctorFlags::Null,
+        "Dumps the NetworkFPC property and network input statistics recorded while net_FPCPropertyStatsEnabled is set, sorted by bytes");
+
+    static void net_FPCPropertyStatsReset([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        NetworkFPCRequestBus::Broadcast(&NetworkFPCRequestBus::Events::ResetNetworkFPCPropertyStats);
+    }
+    AZ_CONSOLEFREEFUNC(
+        net_FPCPropertyStatsReset, AZ::ConsoleFunctorFlags::Null, "Clears the recorded NetworkFPC property and network input statistics");
+
+    // Approximate serialized size of a property or network input value
+    template<typename T>
+    static size_t GetSerializedSize([[maybe_unused]] const T& value)
+    {
+        return sizeof(T);
+    }
+
+    static size_t GetSerializedSize(const AZStd::string& value)
+    {
+        return sizeof(AZ::u32) + value.size();
+    }
+
+    static size_t GetSerializedSize(const AZStd::vector<AZStd::string>& value)
+    {
+        size_t size = sizeof(AZ::u32);
+        for (const AZStd::string& element : value)
+            size += GetSerializedSize(element);
+        return size;
+    }
+
+    static size_t GetSerializedSize(const NetworkFPCRedundantInputs& value)
+    {
+        return sizeof(AZ::u8) + value.m_inputs.size() * sizeof(NetworkFPCRedundantInput);
+    }
+
+    // Every NetworkFPC network input field as X(Name, Member), in NetworkFPC.AutoComponent.xml order
+#define NETWORKFPC_NETWORK_INPUTS(X)                                                                                                       \
+    X(Forward, m_forward)                                                                                                                  \
+    X(Back, m_back)                                                                                                                        \
+    X(Left, m_left)                                                                                                                        \
+    X(Right, m_right)                                                                                                                      \
+    X(DesiredVelocity, m_desiredVelocity)                                                                                                  \
+    X(Yaw, m_yaw)                                                                                                                          \
+    X(YawDelta, m_yawDelta)                                                                                                                \
+    X(OverrideTransform, m_overrideTransform)                                                                                              \
+    X(OverrideTransformForTick, m_overrideTransformForTick)                                                                                \
+    X(OverrideRotationForTick, m_overrideRotationForTick)                                                                                  \
+    X(Pitch, m_pitch)                                                                                                                      \
+    X(Sprint, m_sprint)                                                                                                                    \
+    X(Crouch, m_crouch)                                                                                                                    \
+    X(Jump, m_jump)                                                                                                                        \
+    X(ResetCount, m_resetCount)                                                                                                            \
+    X(RedundantInputs, m_redundantInputs)
+
+    // The fixed ids of the net_FPCPropertyStats statistics, one per network property followed by one per network input field
+    enum NetworkFPCStatId : AZ::u16
+    {
+#define NETWORKFPC_PROPERTY_STAT_ID(NAME, REWINDABLE, PER_TICK_STATE, FROM_AUTONOMOUS) NAME##StatId,
+        NETWORKFPC_NETWORK_PROPERTIES(NETWORKFPC_PROPERTY_STAT_ID)
+#undef NETWORKFPC_PROPERTY_STAT_ID
+#define NETWORKFPC_INPUT_STAT_ID(NAME, MEMBER) Input##NAME##StatId,
+        NETWORKFPC_NETWORK_INPUTS(NETWORKFPC_INPUT_STAT_ID)
+#undef NETWORKFPC_INPUT_STAT_ID
+        NetworkFPCStatIdCount
+    };
+
+    static constexpr const char* NetworkFPCStatNames[] = {
+#define NETWORKFPC_PROPERTY_STAT_NAME(NAME, REWINDABLE, PER_TICK_STATE, FROM_AUTONOMOUS) #NAME,
+        NETWORKFPC_NETWORK_PROPERTIES(NETWORKFPC_PROPERTY_STAT_NAME)
+#undef NETWORKFPC_PROPERTY_STAT_NAME
+#define NETWORKFPC_INPUT_STAT_NAME(NAME, MEMBER) "Input." #NAME,
+        NETWORKFPC_NETWORK_INPUTS(NETWORKFPC_INPUT_STAT_NAME)
+#undef NETWORKFPC_INPUT_STAT_NAME
+    };
+    static_assert(AZStd::size(NetworkFPCStatNames) == NetworkFPCStatIdCount, "Every NetworkFPC statistic id needs a name");
+
+    AZ::u16 GetNetworkFPCStatCount()
+    {
+        return NetworkFPCStatIdCount;
+    }
+
+    const char* GetNetworkFPCStatName(const AZ::u16 statId)
+    {
+        return statId < NetworkFPCStatIdCount ? NetworkFPCStatNames[statId] : "";
+    }
+
+    // The network property values an authority last compared for the net_FPCPropertyStats statistics
+    struct NetworkFPCPropertySnapshot
+    {
+#define NETWORKFPC_SNAPSHOT_PROPERTY(NAME, REWINDABLE, PER_TICK_STATE, FROM_AUTONOMOUS) NETWORKFPC_PROPERTY_TYPE(NAME) m_##NAME;
+        NETWORKFPC_NETWORK_PROPERTIES(NETWORKFPC_SNAPSHOT_PROPERTY)
+#undef NETWORKFPC_SNAPSHOT_PROPERTY
+    };
+
     using namespace StartingPointInput;
 
     void NetworkFPC::Reflect(AZ::ReflectContext* context)
@@ -73,6 +339,10 @@ namespace FirstPersonController
         // Subscribe to EnableNetworkFPC change events
         EnableNetworkAnimationAddEvent(m_enableNetworkAnimationChangedEvent);
 
+        m_countedForRelevanceCulling = GetRelevanceEnabled() && GetRelevanceCullDistance() > 0.f;
+        if (m_countedForRelevanceCulling)
+            ++m_relevanceCullingCharacters;
+
         // Find child entity with anim graph component
         DetectAnimationChild();
 
@@ -93,6 +363,10 @@ namespace FirstPersonController
             EMotionFX::Integration::ActorComponentNotificationBus::Handler::BusDisconnect();
 
         m_enableNetworkAnimationChangedEvent.Disconnect();
+
+        if (m_countedForRelevanceCulling)
+            --m_relevanceCullingCharacters;
+        m_countedForRelevanceCulling = false;
     }
 
     void NetworkFPC::OnEnableNetworkAnimationChanged(const bool enable)
@@ -293,6 +567,21 @@ namespace FirstPersonController
             m_actorRequests->EnableInstanceUpdate(false);
     }
 
+    bool NetworkFPC::IsRelevantToViewer(const AZ::Vector3& viewerTranslation) const
+    {
+        const float cullDistance = GetRelevanceCullDistance();
+        if (!GetRelevanceEnabled() || cullDistance <= 0.f)
+            return true;
+
+        return GetEntity()->GetTransform()->GetWorldTM().GetTranslation().GetDistanceSq(viewerTranslation) <=
+            cullDistance * cullDistance;
+    }
+
+    bool NetworkFPC::GetAnyRelevanceCulling()
+    {
+        return m_relevanceCullingCharacters != 0;
+    }
+
     NetworkFPCController::NetworkFPCController(NetworkFPC& parent)
         : NetworkFPCControllerBase(parent)
         , m_enableNetworkFPCChangedEvent(
@@ -317,6 +606,7 @@ namespace FirstPersonController
     {
         // Disconnect prior to connecting since this may be a reassignment
         InputEventNotificationBus::MultiHandler::BusDisconnect();
+        m_inputDispatchTable.Clear();
 
         if (m_controlMap.size() != (sizeof(m_inputNames) / sizeof(AZStd::string*)))
         {
@@ -333,6 +623,7 @@ namespace FirstPersonController
             {
                 *(it_event.first) = StartingPointInput::InputEventNotificationId(
                     (m_inputNames[std::distance(m_controlMap.begin(), m_controlMap.find(it_event.first))])->c_str());
+                m_inputDispatchTable.Add(*(it_event.first), it_event.second);
                 InputEventNotificationBus::MultiHandler::BusConnect(*(it_event.first));
             }
         }
@@ -346,25 +637,18 @@ namespace FirstPersonController
 
         if (*inputId == m_rotateYawEventId)
         {
-            m_yawValue += value;
+            if (!m_firstPersonControllerObject->m_rawMouseLook)
+                m_yawValue += value;
             return;
         }
         else if (*inputId == m_rotatePitchEventId)
         {
-            m_pitchValue += value;
+            if (!m_firstPersonControllerObject->m_rawMouseLook)
+                m_pitchValue += value;
             return;
         }
 
-        for (auto& it_event : m_controlMap)
-        {
-            if (*inputId == *(it_event.first))
-            {
-                *(it_event.second) = value;
-                return;
-                // print the local user ID and the action name CRC
-                // AZ_Printf("Network FPC Component", "Pressed: %s", it_event.first->ToString().c_str());
-            }
-        }
+        m_inputDispatchTable.Write(*inputId, value);
     }
 
     void NetworkFPCController::OnReleased(float value)
@@ -373,16 +657,7 @@ namespace FirstPersonController
         if (inputId == nullptr || *inputId == m_rotateYawEventId || *inputId == m_rotatePitchEventId)
             return;
 
-        for (auto& it_event : m_controlMap)
-        {
-            if (*inputId == *(it_event.first))
-            {
-                *(it_event.second) = value;
-                return;
-                // print the local user ID and the action name CRC
-                // AZ_Printf("Network FPC Component", "Released: %s", it_event.first->ToString().c_str());
-            }
-        }
+        m_inputDispatchTable.Write(*inputId, value);
     }
 
     void NetworkFPCController::OnHeld(float value)
@@ -393,11 +668,13 @@ namespace FirstPersonController
 
         if (*inputId == m_rotateYawEventId)
         {
-            m_yawValue += value;
+            if (!m_firstPersonControllerObject->m_rawMouseLook)
+                m_yawValue += value;
         }
         else if (*inputId == m_rotatePitchEventId)
         {
-            m_pitchValue += value;
+            if (!m_firstPersonControllerObject->m_rawMouseLook)
+                m_pitchValue += value;
         }
         // Repeatedly update the sprint value since we are setting it to 1 under certain movement conditions
         else if (*inputId == m_sprintEventId)
@@ -456,12 +733,17 @@ namespace FirstPersonController
             if (IsNetEntityRoleAuthority())
             {
                 m_firstPersonControllerObject->m_isHost = true;
+                // The host's own character never goes through the undetermined role in ProcessInput, so it is added here
+                m_firstPersonControllerObject->AddCharacterOnServer(false);
                 NetworkFPCControllerNotificationBus::Broadcast(
                     &NetworkFPCControllerNotificationBus::Events::OnHostActivated, GetEntityId());
             }
             else
             {
                 m_firstPersonControllerObject->m_isAutonomousClient = true;
+                // Only the autonomous client reprocesses inputs, so only it records reprocessing scene query results
+                if (GetReprocessingQueryCache())
+                    m_firstPersonControllerObject->AllocateReprocessingQueryCache();
                 NetworkFPCControllerNotificationBus::Broadcast(
                     &NetworkFPCControllerNotificationBus::Events::OnAutonomousClientActivated, GetEntityId());
             }
@@ -471,14 +753,6 @@ namespace FirstPersonController
         else
             NetworkFPCControllerNotificationBus::Broadcast(
                 &NetworkFPCControllerNotificationBus::Events::OnNonAutonomousClientActivated, GetEntityId());
-
-#if AZ_TRAIT_SERVER
-        if (IsNetEntityRoleAuthority())
-        {
-            AZ::Interface<Multiplayer::IMultiplayer>::Get()->AddConnectionAcquiredHandler(m_connectionAcquiredHandler);
-            AZ::Interface<Multiplayer::IMultiplayer>::Get()->AddEndpointDisconnectedHandler(m_endpointDisconnectedHandler);
-        }
-#endif
     }
 
     void NetworkFPCController::OnDeactivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
@@ -488,8 +762,6 @@ namespace FirstPersonController
         m_enableNetworkFPCChangedEvent.Disconnect();
         m_playerStringNetEntityIdsChangedEvent.Disconnect();
         m_botStringNetEntityIdsChangedEvent.Disconnect();
-        m_connectionAcquiredHandler.Disconnect();
-        m_endpointDisconnectedHandler.Disconnect();
     }
 
     void NetworkFPCController::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
@@ -516,11 +788,16 @@ namespace FirstPersonController
 
     void NetworkFPCController::CreateInput([[maybe_unused]] Multiplayer::NetworkInput& input, [[maybe_unused]] float deltaTime)
     {
+        FPC_PROFILE_STAGE(NetworkFPCCreateInput);
+
         if (m_disabled)
             return;
 
         NetworkFPCNetworkInput* playerInput = input.FindComponentInput<NetworkFPCNetworkInput>();
 
+        if (m_firstPersonControllerObject->m_rawMouseLook)
+            ConsumeRawMouseLook(deltaTime);
+
         // Assign input values
         if (m_allowAllMovementInputs)
         {
@@ -538,13 +815,35 @@ namespace FirstPersonController
             playerInput->m_jump = m_jumpValue;
         }
 
-        playerInput->m_desiredVelocity = GetDesiredVelocity();
+        playerInput->m_desiredVelocity = GetDeriveObservedState() ? m_desiredVelocity : GetDesiredVelocity();
         playerInput->m_yawDelta = GetLookRotationDelta().GetZ();
-        playerInput->m_yawDeltaOvershoot = GetYawDeltaOvershoot();
         playerInput->m_overrideTransformForTick = GetOverrideTransformForTick();
         playerInput->m_overrideRotationForTick = GetOverrideRotationForTick();
         playerInput->m_overrideTransform = GetOverrideTransform();
 
+        // Resend the previous inputs so the server can fill the gap left by lost input packets
+        const AZ::u8 inputRedundancy = AZ::GetMin(GetInputRedundancy(), NetworkFPCRedundantInputs::MaxInputs);
+        playerInput->m_redundantInputs.m_inputs.assign(
+            m_redundantInputHistory.begin(), m_redundantInputHistory.begin() + AZ::GetMin<size_t>(inputRedundancy, m_redundantInputHistory.size()));
+        if (inputRedundancy > 0)
+        {
+            NetworkFPCRedundantInput redundantInput;
+            redundantInput.m_forward = playerInput->m_forward;
+            redundantInput.m_back = playerInput->m_back;
+            redundantInput.m_left = playerInput->m_left;
+            redundantInput.m_right = playerInput->m_right;
+            redundantInput.m_yaw = playerInput->m_yaw;
+            redundantInput.m_yawDelta = playerInput->m_yawDelta;
+            redundantInput.m_pitch = playerInput->m_pitch;
+            redundantInput.m_sprint = playerInput->m_sprint;
+            redundantInput.m_crouch = playerInput->m_crouch;
+            redundantInput.m_jump = playerInput->m_jump;
+            redundantInput.m_desiredVelocity = playerInput->m_desiredVelocity;
+            if (m_redundantInputHistory.size() >= inputRedundancy)
+                m_redundantInputHistory.resize(inputRedundancy - 1);
+            m_redundantInputHistory.insert(m_redundantInputHistory.begin(), redundantInput);
+        }
+
         m_yawValue = 0.0f;
         m_pitchValue = 0.0f;
 
@@ -552,13 +851,43 @@ namespace FirstPersonController
         playerInput->m_resetCount = GetNetworkTransformComponentController()->GetResetCount();
     }
 
-    void NetworkFPCController::ProcessInput([[maybe_unused]] Multiplayer::NetworkInput& input, float deltaTime)
+    void NetworkFPCController::ConsumeRawMouseLook(const float deltaTime)
+    {
+        // Several network ticks can be processed within one frame, so each input is given the movement up to its own tick time
+        // rather than the first receiving everything gathered since the last frame. Fall back to the current time when the ticks
+        // have drifted from it.
+        const AZ::s64 nowUs = static_cast<AZ::s64>(AZ::GetElapsedTimeUs());
+        const AZ::s64 tickDurationUs = static_cast<AZ::s64>(deltaTime * 1e6f);
+        m_rawMouseLookTickTimeUs += tickDurationUs;
+        if (!m_firstPersonControllerObject->m_rawMouseLookSubFrameInterpolation || m_rawMouseLookTickTimeUs > nowUs ||
+            nowUs - m_rawMouseLookTickTimeUs > 4 * tickDurationUs)
+            m_rawMouseLookTickTimeUs = nowUs;
+
+        float yaw = 0.f, pitch = 0.f;
+        AZ::s64 oldestTimeUs = 0;
+        if (m_firstPersonControllerObject->m_rawMouseLookAccumulator.Consume(
+                m_rawMouseLookTickTimeUs, m_firstPersonControllerObject->m_rawMouseLookSubFrameInterpolation, yaw, pitch, oldestTimeUs))
+        {
+            m_yawValue += yaw;
+            m_pitchValue += pitch;
+            // The camera follows the look rotation one network tick behind
+            m_firstPersonControllerObject->RecordInputToCameraLatency(
+                oldestTimeUs, m_firstPersonControllerObject->m_prevNetworkFPCDeltaTime);
+        }
+    }
+
+    void NetworkFPCController::ProcessInput(Multiplayer::NetworkInput& input, float deltaTime)
     {
+        FPC_PROFILE_STAGE(NetworkFPCProcessInput);
+
         // If the input reset count doesn't match the state's reset count it can mean two things:
         //  1) On the server: we were reset and we are now receiving inputs from the client for an old reset count
         //  2) On the client: we were reset and we are replaying old inputs after being corrected
         // In both cases we don't want to process these inputs
         const NetworkFPCNetworkInput* playerInput = input.FindComponentInput<NetworkFPCNetworkInput>();
+        const AZ::u16 clientInputId = static_cast<AZ::u16>(input.GetClientInputId());
+        // Every input the engine hands to the server is tracked, including the ones skipped here, so none is ever recovered twice
+        const AZ::s32 recoverableInputs = IsNetEntityRoleAuthority() ? TrackClientInput(clientInputId, deltaTime) : 0;
         if (m_disabled ||
             input.FindComponentInput<NetworkFPCNetworkInput>()->m_resetCount != GetNetworkTransformComponentController()->GetResetCount())
             return;
@@ -590,32 +919,172 @@ namespace FirstPersonController
                 m_firstPersonControllerObject->m_isServer = true;
                 // Set the server's FPC EntityId to be obtained by the autonomous client
                 SetServerFPCEntityId(AZ::u64(m_firstPersonControllerObject->GetEntity()));
-                FirstPersonControllerComponent::GetPlayerStringNetEntityIdsOnServer();
-                SetPlayerStringNetEntityIds(FirstPersonControllerComponent::m_playerStringNetEntityIds);
-                FirstPersonControllerComponent::m_reacquirePlayerBotStringNetEntityIds = true;
+                // Add this character to the server's player or bot list, every controller picks up the new lists on its next tick
+                m_firstPersonControllerObject->AddCharacterOnServer(m_firstPersonControllerObject->m_isNetBot);
             }
             if (!m_firstPersonControllerObject->m_isServer && !m_firstPersonControllerObject->m_isNetBot)
                 m_disabled = true;
             m_autonomousNotDetermined = false;
         }
 
+        // Reconcile the camera with corrections, replayed inputs move the character immediately while the camera keeps a decaying
+        // offset from where it was before the correction
+        if (IsNetEntityRoleAutonomous())
+        {
+            const bool reprocessingInput = GetNetBindComponent()->IsReprocessingInput();
+            if (reprocessingInput && !m_firstPersonControllerObject->m_correctionReconciling)
+            {
+                m_firstPersonControllerObject->m_correctionSmoothingMode =
+                    static_cast<FirstPersonControllerComponent::CorrectionSmoothingMode>(GetCorrectionSmoothingMode());
+                m_firstPersonControllerObject->m_correctionSmoothingTime = GetCorrectionSmoothingTime();
+                m_firstPersonControllerObject->m_correctionSmoothingMaxDistance = GetCorrectionSmoothingMaxDistance();
+                m_firstPersonControllerObject->BeginCorrectionReconciliation();
+            }
+            else if (!reprocessingInput && m_firstPersonControllerObject->m_correctionReconciling)
+                m_firstPersonControllerObject->FinishCorrectionReconciliation();
+        }
+
+        if (net_FPCPropertyStatsEnabled && IsNetEntityRoleAuthority())
+            RecordInputStats(*playerInput);
+
+        if (recoverableInputs > 0)
+            ProcessRedundantInputs(*playerInput, clientInputId, recoverableInputs, deltaTime);
+
+        ProcessPlayerInput(*playerInput, clientInputId, deltaTime, false);
+    }
+
+    static void RecordNetworkFPCStat(const AzNetworking::ConnectionId connectionId, const AZ::u16 statId, const size_t bytes)
+    {
+        // The listen server's own character has no connection to send to or receive from
+        if (connectionId != AzNetworking::InvalidConnectionId)
+            NetworkFPCRequestBus::Broadcast(
+                &NetworkFPCRequestBus::Events::RecordNetworkFPCPropertyUpdate, static_cast<AZ::u32>(connectionId), statId, bytes);
+    }
+
+    void NetworkFPCController::RecordInputStats(const NetworkFPCNetworkInput& playerInput)
+    {
+        // Count the network input fields that changed since the previous input from this connection
+        const AzNetworking::ConnectionId connectionId = GetNetBindComponent()->GetOwningConnectionId();
+        const auto recordChange = [connectionId](const AZ::u16 statId, const auto& value, const auto& prevValue)
+        {
+            if (value != prevValue)
+                RecordNetworkFPCStat(connectionId, statId, GetSerializedSize(value));
+        };
+#define NETWORKFPC_RECORD_INPUT_STAT(NAME, MEMBER) recordChange(Input##NAME##StatId, playerInput.MEMBER, m_statsPrevInput.MEMBER);
+        NETWORKFPC_NETWORK_INPUTS(NETWORKFPC_RECORD_INPUT_STAT)
+#undef NETWORKFPC_RECORD_INPUT_STAT
+        m_statsPrevInput = playerInput;
+    }
+
+    void NetworkFPCController::RecordPropertyStats()
+    {
+        // The connections this character is replicated to, the players it is relevant to including its own
+        m_statsReceivingConnectionIds.clear();
+        for (const auto& [playerEntityId, playerTranslation] : GetPlayerTranslationsOnServer())
+        {
+            if (playerEntityId != GetEntityId() && !GetParent().IsRelevantToViewer(playerTranslation))
+                continue;
+            const AZ::Entity* playerEntity = AZ::Interface<AZ::ComponentApplicationRequests>::Get()->FindEntity(playerEntityId);
+            const Multiplayer::NetBindComponent* playerNetBind =
+                playerEntity != nullptr ? playerEntity->FindComponent<Multiplayer::NetBindComponent>() : nullptr;
+            if (playerNetBind != nullptr)
+                m_statsReceivingConnectionIds.push_back(playerNetBind->GetOwningConnectionId());
+        }
+
+        // Properties that changed since the previous network tick are sent to every receiving connection, except the ones replicated
+        // from the autonomous client which were received from the owning connection
+        const bool compare = m_statsPrevProperties != nullptr;
+        if (!compare)
+            m_statsPrevProperties = AZStd::make_shared<NetworkFPCPropertySnapshot>();
+        const AzNetworking::ConnectionId owningConnectionId = GetNetBindComponent()->GetOwningConnectionId();
+        const auto recordChange = [this, compare, owningConnectionId](
+                                      const AZ::u16 statId, const bool fromAutonomous, const auto& value, auto& prevValue)
+        {
+            if (compare && value != prevValue)
+            {
+                const size_t bytes = GetSerializedSize(value);
+                if (fromAutonomous)
+                    RecordNetworkFPCStat(owningConnectionId, statId, bytes);
+                else
+                    for (const AzNetworking::ConnectionId connectionId : m_statsReceivingConnectionIds)
+                        RecordNetworkFPCStat(connectionId, statId, bytes);
+            }
+            prevValue = value;
+        };
+#define NETWORKFPC_RECORD_PROPERTY_STAT(NAME, REWINDABLE, PER_TICK_STATE, FROM_AUTONOMOUS)                                                 \
+    recordChange(NAME##StatId, FROM_AUTONOMOUS, Get##NAME(), m_statsPrevProperties->m_##NAME);
+        NETWORKFPC_NETWORK_PROPERTIES(NETWORKFPC_RECORD_PROPERTY_STAT)
+#undef NETWORKFPC_RECORD_PROPERTY_STAT
+    }
+
+    AZ::s32 NetworkFPCController::TrackClientInput(const AZ::u16 clientInputId, const float deltaTime)
+    {
+        // The engine drops inputs older than the last one it processed, so only the ids between that input and this one were never
+        // processed, anything else has nothing to fill
+        const AZ::s16 missedInputs =
+            m_processedClientInput ? static_cast<AZ::s16>(clientInputId - m_lastProcessedClientInputId - 1) : AZ::s16(0);
+        if (missedInputs < 0)
+            return 0;
+        const AZ::TimeMs hostTimeMs = AZ::GetElapsedTimeMs();
+        const float elapsedTime = static_cast<float>(static_cast<AZ::s64>(hostTimeMs - m_lastProcessedClientInputTimeMs)) / 1000.f;
+        m_lastProcessedClientInputId = clientInputId;
+        m_lastProcessedClientInputTimeMs = hostTimeMs;
+        m_processedClientInput = true;
+        if (missedInputs == 0 || deltaTime <= 0.f)
+            return 0;
+
+        // Missed inputs are only recovered within the real time the host spent waiting for this one, so a client skipping ids
+        // can't simulate its character faster than the server's clock
+        const AZ::s32 elapsedTicks = static_cast<AZ::s32>(elapsedTime / deltaTime + 0.5f) - 1;
+        return AZ::GetClamp<AZ::s32>(AZ::GetMin<AZ::s32>(missedInputs, elapsedTicks), 0, NetworkFPCRedundantInputs::MaxInputs);
+    }
+
+    void NetworkFPCController::ProcessRedundantInputs(
+        const NetworkFPCNetworkInput& playerInput, const AZ::u16 clientInputId, const AZ::s32 recoverableInputs, const float deltaTime)
+    {
+        // The copies are newest first, process the missed inputs that have one from oldest to newest
+        const auto& redundantInputs = playerInput.m_redundantInputs.m_inputs;
+        for (AZ::s32 index = AZ::GetMin<AZ::s32>(recoverableInputs, static_cast<AZ::s32>(redundantInputs.size())) - 1; index >= 0; --index)
+        {
+            const NetworkFPCRedundantInput& redundantInput = redundantInputs[index];
+            NetworkFPCNetworkInput missedInput = playerInput;
+            missedInput.m_forward = redundantInput.m_forward;
+            missedInput.m_back = redundantInput.m_back;
+            missedInput.m_left = redundantInput.m_left;
+            missedInput.m_right = redundantInput.m_right;
+            missedInput.m_yaw = redundantInput.m_yaw;
+            missedInput.m_yawDelta = redundantInput.m_yawDelta;
+            missedInput.m_pitch = redundantInput.m_pitch;
+            missedInput.m_sprint = redundantInput.m_sprint;
+            missedInput.m_crouch = redundantInput.m_crouch;
+            missedInput.m_jump = redundantInput.m_jump;
+            missedInput.m_desiredVelocity = redundantInput.m_desiredVelocity;
+            missedInput.m_overrideTransformForTick = false;
+            missedInput.m_overrideRotationForTick = false;
+            ProcessPlayerInput(missedInput, static_cast<AZ::u16>(clientInputId - 1 - index), deltaTime, true);
+        }
+    }
+
+    void NetworkFPCController::ProcessPlayerInput(
+        const NetworkFPCNetworkInput& playerInput, const AZ::u16 clientInputId, const float deltaTime, const bool recoveredInput)
+    {
         // Assign the First Person Controller's inputs from the network inputs
-        m_firstPersonControllerObject->m_forwardValue = playerInput->m_forward;
-        m_firstPersonControllerObject->m_backValue = playerInput->m_back;
-        m_firstPersonControllerObject->m_leftValue = playerInput->m_left;
-        m_firstPersonControllerObject->m_rightValue = playerInput->m_right;
-        m_firstPersonControllerObject->m_yawValue = playerInput->m_yaw;
-        m_firstPersonControllerObject->m_pitchValue = playerInput->m_pitch;
-        m_firstPersonControllerObject->m_sprintValue = playerInput->m_sprint;
-        m_firstPersonControllerObject->m_crouchValue = playerInput->m_crouch;
-        m_firstPersonControllerObject->m_jumpValue = playerInput->m_jump;
-
-        if (playerInput->m_sprint != 0.f &&
+        m_firstPersonControllerObject->m_forwardValue = playerInput.m_forward;
+        m_firstPersonControllerObject->m_backValue = playerInput.m_back;
+        m_firstPersonControllerObject->m_leftValue = playerInput.m_left;
+        m_firstPersonControllerObject->m_rightValue = playerInput.m_right;
+        m_firstPersonControllerObject->m_yawValue = playerInput.m_yaw;
+        m_firstPersonControllerObject->m_pitchValue = playerInput.m_pitch;
+        m_firstPersonControllerObject->m_sprintValue = playerInput.m_sprint;
+        m_firstPersonControllerObject->m_crouchValue = playerInput.m_crouch;
+        m_firstPersonControllerObject->m_jumpValue = playerInput.m_jump;
+
+        if (playerInput.m_sprint != 0.f &&
             (m_firstPersonControllerObject->m_grounded || m_firstPersonControllerObject->m_coyoteTimeNoGravityActive ||
              m_groundedRecently || m_firstPersonControllerObject->m_sprintPrevValue == 0.f || m_firstPersonControllerObject->m_sprintInAir))
         {
-            m_firstPersonControllerObject->m_sprintEffectiveValue = playerInput->m_sprint;
-            m_firstPersonControllerObject->m_sprintAccelValue = playerInput->m_sprint * m_firstPersonControllerObject->m_sprintAccelScale;
+            m_firstPersonControllerObject->m_sprintEffectiveValue = playerInput.m_sprint;
+            m_firstPersonControllerObject->m_sprintAccelValue = playerInput.m_sprint * m_firstPersonControllerObject->m_sprintAccelScale;
         }
         else
         {
@@ -623,16 +1092,16 @@ namespace FirstPersonController
             m_firstPersonControllerObject->m_sprintAccelValue = 0.f;
         }
 
-        if (playerInput->m_overrideTransformForTick || playerInput->m_overrideRotationForTick)
+        if (playerInput.m_overrideTransformForTick || playerInput.m_overrideRotationForTick)
         {
-            if (playerInput->m_overrideTransformForTick)
+            if (playerInput.m_overrideTransformForTick)
             {
-                GetEntity()->GetTransform()->SetWorldTM(playerInput->m_overrideTransform);
+                GetEntity()->GetTransform()->SetWorldTM(playerInput.m_overrideTransform);
                 SetOverrideTransformForTick(false);
             }
             else
             {
-                GetEntity()->GetTransform()->SetWorldRotationQuaternion(playerInput->m_overrideTransform.GetRotation());
+                GetEntity()->GetTransform()->SetWorldRotationQuaternion(playerInput.m_overrideTransform.GetRotation());
                 SetOverrideRotationForTick(false);
             }
 #if AZ_TRAIT_SERVER
@@ -640,34 +1109,119 @@ namespace FirstPersonController
             Multiplayer::NetworkTransformComponentController* netTransform = GetNetworkTransformComponentController();
             netTransform->SetResetCount(netTransform->GetResetCount() + 1);
 #endif
-            m_firstPersonControllerObject->m_currentHeading = playerInput->m_overrideTransform.GetEulerRadians().GetZ();
-            m_firstPersonControllerObject->m_cameraYaw = m_firstPersonControllerObject->m_currentHeading - playerInput->m_yawDelta;
-            m_firstPersonControllerObject->m_networkFPCRotationSliceAccumulator = 0.f;
+            m_firstPersonControllerObject->m_currentHeading = playerInput.m_overrideTransform.GetEulerRadians().GetZ();
+            m_firstPersonControllerObject->m_cameraYaw = m_firstPersonControllerObject->m_currentHeading - playerInput.m_yawDelta;
+            m_firstPersonControllerObject->m_networkFPCLookRotationSamples.clear();
+        }
+
+        // Relevance is already updated by the input that carried the recovered ones
+        if (IsNetEntityRoleAuthority() && !recoveredInput)
+            UpdateRelayRelevance();
+
+        // Inputs replayed after a correction may reuse the static scene query results from when they were first processed
+        m_firstPersonControllerObject->m_reprocessingQueryCacheActive =
+            GetReprocessingQueryCache() && IsNetEntityRoleAutonomous() && !IsNetEntityRoleAuthority();
+        m_firstPersonControllerObject->m_reprocessingInput = GetNetBindComponent()->IsReprocessingInput();
+        m_firstPersonControllerObject->m_reprocessingClientInputId = clientInputId;
+        m_firstPersonControllerObject->m_reprocessingQueryPoseBucket = GetReprocessingQueryPoseBucket();
+
+        // Recovered inputs only run this character's components rather than notifying every handler of another network tick
+        if (recoveredInput)
+        {
+            m_firstPersonControllerObject->OnNetworkTickStart(deltaTime, m_firstPersonControllerObject->m_isServer, GetEntityId());
+            if (m_firstPersonExtrasObject != nullptr)
+                m_firstPersonExtrasObject->OnNetworkTickStart(deltaTime, m_firstPersonControllerObject->m_isServer, GetEntityId());
         }
+        else
+            NetworkFPCControllerNotificationBus::Broadcast(
+                &NetworkFPCControllerNotificationBus::Events::OnNetworkTickStart,
+                deltaTime,
+                m_firstPersonControllerObject->m_isServer,
+                GetEntityId());
 
-        NetworkFPCControllerNotificationBus::Broadcast(
-            &NetworkFPCControllerNotificationBus::Events::OnNetworkTickStart,
-            deltaTime,
-            m_firstPersonControllerObject->m_isServer,
-            GetEntityId());
+        m_firstPersonControllerObject->m_reprocessingQueryCacheActive = false;
 
         const AZ::Quaternion characterRotationQuaternion = AZ::Quaternion::CreateRotationZ(
-            m_firstPersonControllerObject->m_currentHeading + playerInput->m_yawDelta + playerInput->m_yawDeltaOvershoot);
+            m_firstPersonControllerObject->m_currentHeading + playerInput.m_yawDelta);
         GetEntity()->GetTransform()->SetWorldRotationQuaternion(characterRotationQuaternion);
 
-        // if (GetNetBindComponent()->IsReprocessingInput())
-        //     AZ_Printf("Network FPC Component", "Reprocessing Input");
-
         const AZ::Vector3 newTranslation =
-            GetNetworkCharacterComponentController()->TryMoveWithVelocity(playerInput->m_desiredVelocity, deltaTime);
-        SetCurrentTransform(
-            AZ::Transform::CreateFromQuaternionAndTranslation(GetEntity()->GetTransform()->GetWorldRotationQuaternion(), newTranslation));
+            GetNetworkCharacterComponentController()->TryMoveWithVelocity(playerInput.m_desiredVelocity, deltaTime);
+        if (!GetDeriveObservedState())
+            SetCurrentTransform(
+                AZ::Transform::CreateFromQuaternionAndTranslation(GetEntity()->GetTransform()->GetWorldRotationQuaternion(), newTranslation));
+
+        if (net_FPCPropertyStatsEnabled && IsNetEntityRoleAuthority() && !recoveredInput)
+            RecordPropertyStats();
+
+        if (recoveredInput)
+        {
+            m_firstPersonControllerObject->OnNetworkTickFinish(deltaTime, m_firstPersonControllerObject->m_isServer, GetEntityId());
+            if (m_firstPersonExtrasObject != nullptr)
+                m_firstPersonExtrasObject->OnNetworkTickFinish(deltaTime, m_firstPersonControllerObject->m_isServer, GetEntityId());
+        }
+        else
+            NetworkFPCControllerNotificationBus::Broadcast(
+                &NetworkFPCControllerNotificationBus::Events::OnNetworkTickFinish,
+                deltaTime,
+                m_firstPersonControllerObject->m_isServer,
+                GetEntityId());
+    }
+
+    void NetworkFPCController::UpdateRelayRelevance()
+    {
+        const AZ::u8 reducedRateDivisor = GetRelevanceReducedRateDivisor();
+        if (!GetRelevanceEnabled() || reducedRateDivisor <= 1)
+        {
+            m_relayPropertiesDue = true;
+            return;
+        }
+
+        // Only re-evaluate the distance to the other players once every RelevanceCheckInterval network ticks
+        if (m_relevanceCheckCounter == 0)
+            m_relayFullRate = GetOtherPlayerWithinFullRateDistance();
+        m_relevanceCheckCounter = (m_relevanceCheckCounter + 1) % AZStd::max<AZ::u8>(GetRelevanceCheckInterval(), 1);
+
+        // Send the relay properties every network tick when any other player is close enough to see the animation detail
+        if (m_relayFullRate)
+        {
+            m_relayTickCounter = 0;
+            m_relayPropertiesDue = true;
+            return;
+        }
+
+        // Otherwise only mark the relay properties dirty once every reducedRateDivisor network ticks
+        m_relayPropertiesDue = (m_relayTickCounter == 0);
+        m_relayTickCounter = (m_relayTickCounter + 1) % reducedRateDivisor;
+    }
 
-        NetworkFPCControllerNotificationBus::Broadcast(
-            &NetworkFPCControllerNotificationBus::Events::OnNetworkTickFinish,
-            deltaTime,
-            m_firstPersonControllerObject->m_isServer,
-            GetEntityId());
+    bool NetworkFPCController::GetOtherPlayerWithinFullRateDistance() const
+    {
+        const AZ::Vector3 translation = GetEntity()->GetTransform()->GetWorldTM().GetTranslation();
+        const float fullRateDistanceSquared = GetRelevanceFullRateDistance() * GetRelevanceFullRateDistance();
+        for (const auto& [playerEntityId, playerTranslation] : GetPlayerTranslationsOnServer())
+            if (playerEntityId != GetEntityId() && translation.GetDistanceSq(playerTranslation) <= fullRateDistanceSquared)
+                return true;
+        return false;
+    }
+
+    const AZStd::vector<AZStd::pair<AZ::EntityId, AZ::Vector3>>& NetworkFPCController::GetPlayerTranslationsOnServer()
+    {
+        // Gather at most once per network tick, however many characters check their relevance
+        const AZ::u32 frame = static_cast<AZ::u32>(Multiplayer::GetNetworkTime()->GetHostFrameId());
+        if (frame == m_playerTranslationsFrame)
+            return m_playerTranslationsOnServer;
+        m_playerTranslationsFrame = frame;
+
+        m_playerTranslationsOnServer.clear();
+        m_playerTranslationsOnServer.reserve(FirstPersonControllerComponent::m_playerEntityIdsOnServer.size());
+        for (const AZ::EntityId& playerEntityId : FirstPersonControllerComponent::m_playerEntityIdsOnServer)
+        {
+            AZ::Vector3 playerTranslation = AZ::Vector3::CreateZero();
+            AZ::TransformBus::EventResult(playerTranslation, playerEntityId, &AZ::TransformBus::Events::GetWorldTranslation);
+            m_playerTranslationsOnServer.emplace_back(playerEntityId, playerTranslation);
+        }
+        return m_playerTranslationsOnServer;
     }
 
 #if AZ_TRAIT_SERVER
@@ -688,20 +1242,6 @@ namespace FirstPersonController
         else
             SetChildParentStringNetEntityId("");
     }
-
-    // Connect and disconnect events
-    void NetworkFPCController::OnConnectionAcquired()
-    {
-        FirstPersonControllerComponent::GetPlayerStringNetEntityIdsOnServer();
-        SetPlayerStringNetEntityIds(FirstPersonControllerComponent::m_playerStringNetEntityIds);
-        FirstPersonControllerComponent::m_reacquirePlayerBotStringNetEntityIds = true;
-    }
-    void NetworkFPCController::OnEndpointDisconnected()
-    {
-        FirstPersonControllerComponent::GetPlayerStringNetEntityIdsOnServer();
-        SetPlayerStringNetEntityIds(FirstPersonControllerComponent::m_playerStringNetEntityIds);
-        FirstPersonControllerComponent::m_reacquirePlayerBotStringNetEntityIds = true;
-    }
 #endif
 
     // Event Notification methods for use in scripts
@@ -820,4 +1360,42 @@ namespace FirstPersonController
                 m_firstPersonExtrasObject->AssignConnectInputEvents();
         }
     }
+
+    bool NetworkFPCRelevanceFilter::IsEntityFiltered(
+        AZ::Entity* entity, Multiplayer::ConstNetworkEntityHandle controllerEntity, [[maybe_unused]] AzNetworking::ConnectionId connectionId)
+    {
+        // Nothing is culled while no character has a cull distance, so the hierarchy isn't walked for every entity
+        if (!NetworkFPC::GetAnyRelevanceCulling())
+            return false;
+
+        const AZ::Entity* viewerEntity = controllerEntity.GetEntity();
+        if (entity == nullptr || viewerEntity == nullptr || viewerEntity->GetTransform() == nullptr)
+            return false;
+
+        // Walk up the transform hierarchy so that the child entities of a culled character are culled along with it
+        static constexpr AZ::u8 MaxHierarchyDepth = 8;
+        const AZ::Entity* characterEntity = entity;
+        const NetworkFPC* networkFPC = characterEntity->FindComponent<NetworkFPC>();
+        for (AZ::u8 depth = 0; networkFPC == nullptr && depth < MaxHierarchyDepth; ++depth)
+        {
+            if (characterEntity->GetTransform() == nullptr)
+                return false;
+
+            const AZ::EntityId parentId = characterEntity->GetTransform()->GetParentId();
+            if (!parentId.IsValid())
+                return false;
+
+            characterEntity = AZ::Interface<AZ::ComponentApplicationRequests>::Get()->FindEntity(parentId);
+            if (characterEntity == nullptr)
+                return false;
+
+            networkFPC = characterEntity->FindComponent<NetworkFPC>();
+        }
+
+        // Never cull a connection's own character
+        if (networkFPC == nullptr || characterEntity == viewerEntity)
+            return false;
+
+        return !networkFPC->IsRelevantToViewer(viewerEntity->GetTransform()->GetWorldTM().GetTranslation());
+    }
 } // namespace FirstPersonController
@@ -4,16 +4,19 @@
 
 #pragma once
 #include <FirstPersonController/NetworkFPCControllerBus.h>
+#include <Multiplayer/NetworkFPCRedundantInputs.h>
 
 #include <Source/AutoGen/NetworkFPC.AutoComponent.h>
 
 #include <Clients/FirstPersonControllerComponent.h>
 #include <Clients/FirstPersonExtrasComponent.h>
+#include <Clients/InputEventDispatchTable.h>
 
 #include <Integration/ActorComponentBus.h>
 #include <Integration/AnimGraphComponentBus.h>
 
 #include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/NetworkEntity/IFilterEntityManager.h>
 
 namespace EMotionFX
 {
@@ -35,6 +38,8 @@ namespace FirstPersonController
 
     class FirstPersonExtrasComponent;
 
+    struct NetworkFPCPropertySnapshot;
+
     class NetworkFPC
         : public NetworkFPCBase
         , public EMotionFX::Integration::ActorComponentNotificationBus::Handler
@@ -51,7 +56,16 @@ namespace FirstPersonController
         void OnActivate(Multiplayer::EntityIsMigrating entityIsMigrating) override;
         void OnDeactivate(Multiplayer::EntityIsMigrating entityIsMigrating) override;
 
+        // Whether this character should be replicated to a connection whose controlled entity is at viewerTranslation
+        bool IsRelevantToViewer(const AZ::Vector3& viewerTranslation) const;
+        // Whether any active character can be culled by distance, so the relevance filter has anything to do
+        static bool GetAnyRelevanceCulling();
+
     private:
+        // Number of active characters with relevance enabled and a cull distance
+        inline static AZ::u32 m_relevanceCullingCharacters = 0;
+        bool m_countedForRelevanceCulling = false;
+
         void OnPreRender(float deltaTime);
 
         // EnableAnimationNetworkFPC Changed Event
@@ -168,23 +182,55 @@ namespace FirstPersonController
         void OnHostActivated(const AZ::EntityId& entityId);
         void OnNonAutonomousClientActivated(const AZ::EntityId& entityId);
 
-        // Connect and disconnect events
-        void OnConnectionAcquired();
-        void OnEndpointDisconnected();
-        Multiplayer::ConnectionAcquiredEvent::Handler m_connectionAcquiredHandler = Multiplayer::ConnectionAcquiredEvent::Handler(
-            [this](Multiplayer::MultiplayerAgentDatum)
-            {
-                this->OnConnectionAcquired();
-            });
-        Multiplayer::EndpointDisconnectedEvent::Handler m_endpointDisconnectedHandler = Multiplayer::EndpointDisconnectedEvent::Handler(
-            [this](Multiplayer::MultiplayerAgentType)
-            {
-                this->OnEndpointDisconnected();
-            });
-
         // Used to initialize Network Properties from initial values in the First Person Controller component
         bool m_init = true;
 
+        // Version of the server's player and bot lists last set in this controller's network properties
+        AZ::u32 m_playerBotStringNetEntityIdsVersion = 0;
+
+        // Distance based relevance, decides whether the relay properties are sent on this network tick
+        void UpdateRelayRelevance();
+        bool GetOtherPlayerWithinFullRateDistance() const;
+        bool m_relayPropertiesDue = true;
+        bool m_relayFullRate = false;
+        AZ::u8 m_relayTickCounter = 0;
+        AZ::u8 m_relevanceCheckCounter = 0;
+
+        // The server's player translations, gathered at most once per network tick and shared by every character's relevance check
+        static const AZStd::vector<AZStd::pair<AZ::EntityId, AZ::Vector3>>& GetPlayerTranslationsOnServer();
+        inline static AZStd::vector<AZStd::pair<AZ::EntityId, AZ::Vector3>> m_playerTranslationsOnServer;
+        inline static AZ::u32 m_playerTranslationsFrame = AZStd::numeric_limits<AZ::u32>::max();
+
+        // Desired velocity carried from the network tick into the next input when DeriveObservedState is enabled
+        AZ::Vector3 m_desiredVelocity = AZ::Vector3::CreateZero();
+
+        // Runs the First Person Controller for one network input, recovered inputs are copies of inputs the server never received
+        void ProcessPlayerInput(
+            const NetworkFPCNetworkInput& playerInput, const AZ::u16 clientInputId, const float deltaTime, const bool recoveredInput);
+
+        // Input redundancy, the client's previous inputs and the server's processing of the copies of inputs it never received,
+        // limited to the ids the engine skipped and to the host time elapsed since the previous input
+        AZ::s32 TrackClientInput(const AZ::u16 clientInputId, const float deltaTime);
+        void ProcessRedundantInputs(
+            const NetworkFPCNetworkInput& playerInput, const AZ::u16 clientInputId, const AZ::s32 recoverableInputs, const float deltaTime);
+        AZStd::fixed_vector<NetworkFPCRedundantInput, NetworkFPCRedundantInputs::MaxInputs> m_redundantInputHistory;
+        AZ::u16 m_lastProcessedClientInputId = 0;
+        AZ::TimeMs m_lastProcessedClientInputTimeMs = AZ::TimeMs{ 0 };
+        bool m_processedClientInput = false;
+
+        // Records the network input fields received from the owning connection for the net_FPCPropertyStats statistics
+        void RecordInputStats(const NetworkFPCNetworkInput& playerInput);
+        NetworkFPCNetworkInput m_statsPrevInput;
+
+        // Records the network properties the server sends to each connection, compared once per network tick
+        void RecordPropertyStats();
+        AZStd::shared_ptr<NetworkFPCPropertySnapshot> m_statsPrevProperties;
+        AZStd::vector<AzNetworking::ConnectionId> m_statsReceivingConnectionIds;
+
+        // Adds the raw mouse movement up to this input's tick time to the yaw and pitch values when Raw Mouse Look is enabled
+        void ConsumeRawMouseLook(const float deltaTime);
+        AZ::s64 m_rawMouseLookTickTimeUs = 0;
+
         // EnableNetworkFPC Changed Event
         AZ::Event<bool>::Handler m_enableNetworkFPCChangedEvent;
         AZ::Event<AZStd::vector<AZStd::string>>::Handler m_playerStringNetEntityIdsChangedEvent;
@@ -251,5 +297,17 @@ namespace FirstPersonController
             { &m_moveRightEventId, &m_rightValue },     { &m_rotateYawEventId, &m_yawValue }, { &m_rotatePitchEventId, &m_pitchValue },
             { &m_sprintEventId, &m_sprintValue },       { &m_crouchEventId, &m_crouchValue }, { &m_jumpEventId, &m_jumpValue }
         };
+
+        // Event IDs resolved from m_controlMap in AssignConnectInputEvents, looked up on each input notification
+        InputEventDispatchTable m_inputDispatchTable;
+    };
+
+    // Per-connection relevance filter, registered by the system component when no other filter is in use. Culls NetworkFPC
+    // characters, along with the network entities parented to them, from connections beyond the Relevance Cull Distance.
+    class NetworkFPCRelevanceFilter : public Multiplayer::IFilterEntityManager
+    {
+    public:
+        bool IsEntityFiltered(
+            AZ::Entity* entity, Multiplayer::ConstNetworkEntityHandle controllerEntity, AzNetworking::ConnectionId connectionId) override;
     };
 } // namespace FirstPersonController
@@ -247,6 +247,9 @@ namespace FirstPersonController
 
     void NetworkFPCBotAnimationController::OnActivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
     {
+        // Bots without NetworkFPC are added to the server's bot list here, and removed when their First Person Controller deactivates
+        if (IsNetEntityRoleAuthority())
+            GetEntity()->FindComponent<FirstPersonControllerComponent>()->AddCharacterOnServer(true);
     }
 
     void NetworkFPCBotAnimationController::OnDeactivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
@@ -0,0 +1,102 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Multiplayer/NetworkFPCPropertyStats.h>
+
+#include <AzCore/std/sort.h>
+#include <AzCore/std/tuple.h>
+
+namespace FirstPersonController
+{
+    void NetworkFPCPropertyStats::Record(const AZ::u32 connectionId, const AZ::u16 statId, const size_t bytes)
+    {
+        if (statId >= GetNetworkFPCStatCount())
+            return;
+        if (m_connectionEntries.empty())
+            m_startTimeMs = AZ::GetElapsedTimeMs();
+
+        AZStd::vector<Entry>& entries = m_connectionEntries[connectionId];
+        if (entries.empty())
+            entries.resize(GetNetworkFPCStatCount());
+        ++entries[statId].m_updateCount;
+        entries[statId].m_bytes += bytes;
+    }
+
+    void NetworkFPCPropertyStats::Reset()
+    {
+        m_connectionEntries.clear();
+    }
+
+    AZ::u16 NetworkFPCPropertyStats::FindStatId(const AZStd::string& name) const
+    {
+        const AZ::u16 statCount = GetNetworkFPCStatCount();
+        for (AZ::u16 statId = 0; statId < statCount; ++statId)
+            if (name == GetNetworkFPCStatName(statId))
+                return statId;
+        return statCount;
+    }
+
+    AZ::u64 NetworkFPCPropertyStats::GetUpdateCount(const AZStd::string& name) const
+    {
+        const AZ::u16 statId = FindStatId(name);
+        AZ::u64 updateCount = 0;
+        for (const auto& [connectionId, entries] : m_connectionEntries)
+            if (statId < entries.size())
+                updateCount += entries[statId].m_updateCount;
+        return updateCount;
+    }
+
+    AZ::u64 NetworkFPCPropertyStats::GetBytes(const AZStd::string& name) const
+    {
+        const AZ::u16 statId = FindStatId(name);
+        AZ::u64 bytes = 0;
+        for (const auto& [connectionId, entries] : m_connectionEntries)
+            if (statId < entries.size())
+                bytes += entries[statId].m_bytes;
+        return bytes;
+    }
+
+    float NetworkFPCPropertyStats::GetUpdateRate(const AZStd::string& name) const
+    {
+        const float elapsedSeconds = GetElapsedSeconds();
+        return elapsedSeconds > 0.f ? static_cast<float>(GetUpdateCount(name)) / elapsedSeconds : 0.f;
+    }
+
+    float NetworkFPCPropertyStats::GetElapsedSeconds() const
+    {
+        if (m_connectionEntries.empty())
+            return 0.f;
+        return static_cast<float>(static_cast<AZ::s64>(AZ::GetElapsedTimeMs() - m_startTimeMs)) / 1000.f;
+    }
+
+    void NetworkFPCPropertyStats::Dump() const
+    {
+        using EntryRef = AZStd::tuple<AZ::u32, AZ::u16, const Entry*>;
+        AZStd::vector<EntryRef> sortedEntries;
+        for (const auto& [connectionId, entries] : m_connectionEntries)
+            for (AZ::u16 statId = 0; statId < entries.size(); ++statId)
+                if (entries[statId].m_updateCount != 0)
+                    sortedEntries.emplace_back(connectionId, statId, &entries[statId]);
+        AZStd::sort(
+            sortedEntries.begin(),
+            sortedEntries.end(),
+            [](const EntryRef& lhs, const EntryRef& rhs)
+            {
+                return AZStd::get<2>(lhs)->m_bytes > AZStd::get<2>(rhs)->m_bytes;
+            });
+
+        const float elapsedSeconds = GetElapsedSeconds();
+        AZ_Printf("NetworkFPC", "Property stats over %.1f s", elapsedSeconds);
+        AZ_Printf("NetworkFPC", "%-10s %-28s %10s %12s %10s", "Connection", "Property", "Updates", "Bytes", "Updates/s");
+        for (const auto& [connectionId, statId, entry] : sortedEntries)
+            AZ_Printf(
+                "NetworkFPC",
+                "%-10u %-28s %10llu %12llu %10.2f",
+                connectionId,
+                GetNetworkFPCStatName(statId),
+                static_cast<unsigned long long>(entry->m_updateCount),
+                static_cast<unsigned long long>(entry->m_bytes),
+                elapsedSeconds > 0.f ? static_cast<float>(entry->m_updateCount) / elapsedSeconds : 0.f);
+    }
+} // namespace FirstPersonController
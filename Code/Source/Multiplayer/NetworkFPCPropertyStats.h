@@ -0,0 +1,48 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace FirstPersonController
+{
+    // The statistic ids and names, one per NetworkFPC property and network input field, defined with the property list in NetworkFPC.cpp
+    AZ::u16 GetNetworkFPCStatCount();
+    const char* GetNetworkFPCStatName(const AZ::u16 statId);
+
+    // Debug statistics of the NetworkFPC properties sent and network inputs received on each connection, recorded while
+    // net_FPCPropertyStatsEnabled is set
+    class NetworkFPCPropertyStats
+    {
+    public:
+        void Record(const AZ::u32 connectionId, const AZ::u16 statId, const size_t bytes);
+        void Reset();
+
+        // Totals across all connections
+        AZ::u64 GetUpdateCount(const AZStd::string& name) const;
+        AZ::u64 GetBytes(const AZStd::string& name) const;
+        float GetUpdateRate(const AZStd::string& name) const;
+
+        // Prints the recorded statistics sorted by the bytes transferred, highest first
+        void Dump() const;
+
+    private:
+        struct Entry
+        {
+            AZ::u64 m_updateCount = 0;
+            AZ::u64 m_bytes = 0;
+        };
+
+        AZ::u16 FindStatId(const AZStd::string& name) const;
+        float GetElapsedSeconds() const;
+
+        // Each connection's entries indexed by statistic id
+        AZStd::unordered_map<AZ::u32, AZStd::vector<Entry>> m_connectionEntries;
+        AZ::TimeMs m_startTimeMs = AZ::TimeMs{ 0 };
+    };
+} // namespace FirstPersonController
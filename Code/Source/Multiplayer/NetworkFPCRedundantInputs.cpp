@@ -0,0 +1,89 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Multiplayer/NetworkFPCRedundantInputs.h>
+
+namespace FirstPersonController
+{
+    namespace
+    {
+        // Writes a changed bit, followed by the value only when it differs from the reference
+        void SerializeDelta(AzNetworking::ISerializer& serializer, float& value, const float reference, const char* name)
+        {
+            bool changed = value != reference;
+            serializer.Serialize(changed, name);
+            if (changed)
+                serializer.Serialize(value, name);
+            else
+                value = reference;
+        }
+
+        void SerializeDelta(AzNetworking::ISerializer& serializer, AZ::Vector3& value, const AZ::Vector3& reference, const char* name)
+        {
+            bool changed = !value.IsClose(reference, 0.f);
+            serializer.Serialize(changed, name);
+            if (changed)
+            {
+                float x = value.GetX(), y = value.GetY(), z = value.GetZ();
+                serializer.Serialize(x, name);
+                serializer.Serialize(y, name);
+                serializer.Serialize(z, name);
+                value.Set(x, y, z);
+            }
+            else
+                value = reference;
+        }
+    } // namespace
+
+    bool NetworkFPCRedundantInput::operator==(const NetworkFPCRedundantInput& rhs) const
+    {
+        return m_forward == rhs.m_forward && m_back == rhs.m_back && m_left == rhs.m_left && m_right == rhs.m_right &&
+            m_yaw == rhs.m_yaw && m_yawDelta == rhs.m_yawDelta && m_pitch == rhs.m_pitch && m_sprint == rhs.m_sprint &&
+            m_crouch == rhs.m_crouch && m_jump == rhs.m_jump && m_desiredVelocity == rhs.m_desiredVelocity;
+    }
+
+    bool NetworkFPCRedundantInput::operator!=(const NetworkFPCRedundantInput& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
+    bool NetworkFPCRedundantInputs::Serialize(AzNetworking::ISerializer& serializer)
+    {
+        AZ::u8 count = static_cast<AZ::u8>(m_inputs.size());
+        serializer.Serialize(count, "Count", 0, MaxInputs);
+        if (serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject)
+            m_inputs.resize(AZ::GetMin(count, MaxInputs));
+
+        // The first copy is encoded against a default input, every other copy against the copy before it
+        const NetworkFPCRedundantInput defaultInput;
+        for (size_t index = 0; index < m_inputs.size(); ++index)
+        {
+            NetworkFPCRedundantInput& input = m_inputs[index];
+            const NetworkFPCRedundantInput& reference = index > 0 ? m_inputs[index - 1] : defaultInput;
+            SerializeDelta(serializer, input.m_forward, reference.m_forward, "Forward");
+            SerializeDelta(serializer, input.m_back, reference.m_back, "Back");
+            SerializeDelta(serializer, input.m_left, reference.m_left, "Left");
+            SerializeDelta(serializer, input.m_right, reference.m_right, "Right");
+            SerializeDelta(serializer, input.m_yaw, reference.m_yaw, "Yaw");
+            SerializeDelta(serializer, input.m_yawDelta, reference.m_yawDelta, "YawDelta");
+            SerializeDelta(serializer, input.m_pitch, reference.m_pitch, "Pitch");
+            SerializeDelta(serializer, input.m_sprint, reference.m_sprint, "Sprint");
+            SerializeDelta(serializer, input.m_crouch, reference.m_crouch, "Crouch");
+            SerializeDelta(serializer, input.m_jump, reference.m_jump, "Jump");
+            SerializeDelta(serializer, input.m_desiredVelocity, reference.m_desiredVelocity, "DesiredVelocity");
+        }
+
+        return serializer.IsValid();
+    }
+
+    bool NetworkFPCRedundantInputs::operator==(const NetworkFPCRedundantInputs& rhs) const
+    {
+        return m_inputs == rhs.m_inputs;
+    }
+
+    bool NetworkFPCRedundantInputs::operator!=(const NetworkFPCRedundantInputs& rhs) const
+    {
+        return !(*this == rhs);
+    }
+} // namespace FirstPersonController
@@ -0,0 +1,46 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/fixed_vector.h>
+
+#include <AzNetworking/Serialization/ISerializer.h>
+
+namespace FirstPersonController
+{
+    // The per-tick values of a previous NetworkFPC input
+    struct NetworkFPCRedundantInput
+    {
+        float m_forward = 0.f;
+        float m_back = 0.f;
+        float m_left = 0.f;
+        float m_right = 0.f;
+        float m_yaw = 0.f;
+        float m_yawDelta = 0.f;
+        float m_pitch = 0.f;
+        float m_sprint = 0.f;
+        float m_crouch = 0.f;
+        float m_jump = 0.f;
+        AZ::Vector3 m_desiredVelocity = AZ::Vector3::CreateZero();
+
+        bool operator==(const NetworkFPCRedundantInput& rhs) const;
+        bool operator!=(const NetworkFPCRedundantInput& rhs) const;
+    };
+
+    // Copies of the previous inputs, newest first, sent along with each NetworkFPC input so the server can fill the gap left by lost
+    // input packets. Each copy is delta encoded against the one before it, so unchanged values only cost a bit.
+    struct NetworkFPCRedundantInputs
+    {
+        static constexpr AZ::u8 MaxInputs = 4;
+
+        AZStd::fixed_vector<NetworkFPCRedundantInput, MaxInputs> m_inputs;
+
+        bool Serialize(AzNetworking::ISerializer& serializer);
+
+        bool operator==(const NetworkFPCRedundantInputs& rhs) const;
+        bool operator!=(const NetworkFPCRedundantInputs& rhs) const;
+    };
+} // namespace FirstPersonController
@@ -0,0 +1,103 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <Clients/CharacterMotionCore.h>
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/containers/array.h>
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    using namespace FirstPersonController;
+
+    // Inputs are generated up front so only the kernels are measured
+    class CharacterMotionCoreBenchmark : public ::benchmark::Fixture
+    {
+    public:
+        void SetUp(const ::benchmark::State&) override
+        {
+            AZ::SimpleLcgRandom random(1234);
+            for (AZ::Vector2& input : m_inputs)
+                input = AZ::Vector2(random.GetRandomFloat() * 2.f - 1.f, random.GetRandomFloat() * 2.f - 1.f);
+
+            m_params.m_accel = 8.f;
+            m_params.m_decel = 12.f;
+            m_params.m_opposingDecel = 16.f;
+            m_params.m_speed = 4.f;
+        }
+
+    protected:
+        static constexpr size_t InputCount = 1024;
+        AZStd::array<AZ::Vector2, InputCount> m_inputs;
+        CharacterMotionCore::VelocityXYParams m_params;
+    };
+
+    BENCHMARK_F(CharacterMotionCoreBenchmark, CreateEllipseScaledVector)(::benchmark::State& state)
+    {
+        size_t index = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            const AZ::Vector2 scaledVector =
+                CharacterMotionCore::CreateEllipseScaledVector(m_inputs[index++ % InputCount], 1.5f, 0.75f, 1.f, 1.f);
+            ::benchmark::DoNotOptimize(scaledVector);
+        }
+    }
+
+    BENCHMARK_F(CharacterMotionCoreBenchmark, LerpVelocityXY)(::benchmark::State& state)
+    {
+        CharacterMotionCore::VelocityXYState velocityState;
+        const CharacterMotionCore::QueryResults queryResults;
+        size_t index = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            velocityState.m_prevApplyVelocityXY = velocityState.m_applyVelocityXY;
+            velocityState.m_applyVelocityXY = CharacterMotionCore::LerpVelocityXY(
+                velocityState, m_params, queryResults, m_inputs[index++ % InputCount] * m_params.m_speed, 1.f / 60.f);
+            ::benchmark::DoNotOptimize(velocityState.m_applyVelocityXY);
+        }
+    }
+
+    BENCHMARK_F(CharacterMotionCoreBenchmark, DecayLinearImpulse)(::benchmark::State& state)
+    {
+        CharacterMotionCore::ImpulseState impulseState;
+        const CharacterMotionCore::ImpulseParams impulseParams;
+        CharacterMotionCore::QueryResults queryResults;
+        queryResults.m_groundHit = true;
+        queryResults.m_groundDynamicFriction = 0.5f;
+        AZ::Vector2 applyVelocityXY = AZ::Vector2::CreateZero();
+        float applyVelocityZ = 0.f;
+        size_t index = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            // A new impulse every 16 ticks keeps the decay running
+            if (index % 16 == 0)
+                impulseState.m_linearImpulse = AZ::Vector3(m_inputs[index % InputCount]) * 10.f;
+            ++index;
+            CharacterMotionCore::DecayLinearImpulse(
+                impulseState, impulseParams, queryResults, 1.f / 60.f, applyVelocityXY, applyVelocityZ);
+            ::benchmark::DoNotOptimize(applyVelocityXY);
+        }
+    }
+
+    BENCHMARK_F(CharacterMotionCoreBenchmark, Stamina)(::benchmark::State& state)
+    {
+        CharacterMotionCore::StaminaState staminaState;
+        const CharacterMotionCore::StaminaParams staminaParams;
+        size_t index = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            // Alternate sprinting and resting every second of 60 Hz ticks
+            const AZ::u8 events = (index++ / 60) % 2 == 0
+                ? CharacterMotionCore::DrainStamina(staminaState, staminaParams, 1.5f, 1.5f, 1.f / 60.f)
+                : CharacterMotionCore::RecoverStamina(staminaState, staminaParams, 1.f / 60.f);
+            ::benchmark::DoNotOptimize(events);
+        }
+    }
+} // namespace Benchmark
+
+#endif
@@ -0,0 +1,337 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Clients/CharacterMotionCore.h>
+
+#include <AzCore/Math/Random.h>
+#include <AzTest/AzTest.h>
+
+namespace UnitTest
+{
+    using namespace FirstPersonController;
+
+    class CharacterMotionCoreTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            m_params.m_accel = 2.f;
+            m_params.m_decel = 2.f;
+            m_params.m_opposingDecel = 3.f;
+            m_params.m_speed = 4.f;
+
+            m_staminaParams.m_maxTime = 1.f;
+            m_staminaParams.m_pauseTime = 0.5f;
+            m_staminaParams.m_totalCooldownTime = 2.f;
+            m_staminaParams.m_regenRate = 1.f;
+        }
+
+        void SetMoving(const AZ::Vector2& velocityXY)
+        {
+            m_state.m_prevApplyVelocityXY = velocityXY;
+            m_state.m_applyVelocityXY = velocityXY;
+        }
+
+        CharacterMotionCore::VelocityXYParams m_params;
+        CharacterMotionCore::VelocityXYState m_state;
+        CharacterMotionCore::QueryResults m_queryResults;
+        CharacterMotionCore::StaminaParams m_staminaParams;
+        CharacterMotionCore::StaminaState m_staminaState;
+    };
+
+    TEST_F(CharacterMotionCoreTest, LerpVelocityXY_AtTarget_HoldsVelocity)
+    {
+        SetMoving(AZ::Vector2(0.f, 4.f));
+
+        const AZ::Vector2 velocity =
+            CharacterMotionCore::LerpVelocityXY(m_state, m_params, m_queryResults, AZ::Vector2(0.f, 4.f), 0.5f);
+
+        EXPECT_TRUE(velocity.IsClose(AZ::Vector2(0.f, 4.f)));
+        EXPECT_FALSE(m_state.m_accelerating);
+        EXPECT_FALSE(m_state.m_decelerationFactorApplied);
+        EXPECT_FALSE(m_state.m_opposingDecelFactorApplied);
+    }
+
+    TEST_F(CharacterMotionCoreTest, LerpVelocityXY_FromRest_AcceleratesAtAccel)
+    {
+        const AZ::Vector2 velocity =
+            CharacterMotionCore::LerpVelocityXY(m_state, m_params, m_queryResults, AZ::Vector2(0.f, 4.f), 0.5f);
+
+        EXPECT_TRUE(velocity.IsClose(AZ::Vector2(0.f, 1.f)));
+        EXPECT_TRUE(m_state.m_accelerating);
+        EXPECT_FLOAT_EQ(m_state.m_totalLerpTime, 2.f);
+        EXPECT_FLOAT_EQ(m_state.m_lerpTime, 0.5f);
+    }
+
+    TEST_F(CharacterMotionCoreTest, LerpVelocityXY_LongTimestep_ClampsToTarget)
+    {
+        const AZ::Vector2 velocity =
+            CharacterMotionCore::LerpVelocityXY(m_state, m_params, m_queryResults, AZ::Vector2(0.f, 4.f), 3.f);
+
+        EXPECT_TRUE(velocity.IsClose(AZ::Vector2(0.f, 4.f)));
+        EXPECT_FLOAT_EQ(m_state.m_lerpTime, m_state.m_totalLerpTime);
+    }
+
+    TEST_F(CharacterMotionCoreTest, LerpVelocityXY_Airborne_ScalesByJumpAccelFactor)
+    {
+        m_params.m_jumpAccelFactor = 0.5f;
+        m_queryResults.m_grounded = false;
+
+        const AZ::Vector2 velocity =
+            CharacterMotionCore::LerpVelocityXY(m_state, m_params, m_queryResults, AZ::Vector2(0.f, 4.f), 0.5f);
+
+        EXPECT_TRUE(velocity.IsClose(AZ::Vector2(0.f, 0.5f)));
+    }
+
+    TEST_F(CharacterMotionCoreTest, LerpVelocityXY_Stopping_DeceleratesAtDecel)
+    {
+        SetMoving(AZ::Vector2(0.f, 4.f));
+
+        const AZ::Vector2 velocity =
+            CharacterMotionCore::LerpVelocityXY(m_state, m_params, m_queryResults, AZ::Vector2::CreateZero(), 0.5f);
+
+        EXPECT_TRUE(velocity.IsClose(AZ::Vector2(0.f, 2.f)));
+        EXPECT_FALSE(m_state.m_accelerating);
+        EXPECT_TRUE(m_state.m_decelerationFactorApplied);
+        EXPECT_FALSE(m_state.m_opposingDecelFactorApplied);
+        EXPECT_FLOAT_EQ(m_state.m_decelerationFactor, m_params.m_decel);
+    }
+
+    TEST_F(CharacterMotionCoreTest, LerpVelocityXY_Reversing_DeceleratesAtOpposingDecel)
+    {
+        SetMoving(AZ::Vector2(0.f, 4.f));
+
+        const AZ::Vector2 velocity =
+            CharacterMotionCore::LerpVelocityXY(m_state, m_params, m_queryResults, AZ::Vector2(0.f, -4.f), 0.5f);
+
+        // A full speed reversal decelerates at the opposing deceleration
+        EXPECT_TRUE(velocity.IsClose(AZ::Vector2(0.f, 1.f)));
+        EXPECT_FALSE(m_state.m_decelerationFactorApplied);
+        EXPECT_TRUE(m_state.m_opposingDecelFactorApplied);
+        EXPECT_FLOAT_EQ(m_state.m_decelerationFactor, m_params.m_opposingDecel);
+    }
+
+    TEST(CharacterMotionCore, GreatestScale_KeepsSignOfGreatestMagnitude)
+    {
+        EXPECT_FLOAT_EQ(CharacterMotionCore::GreatestScale(1.f, 0.5f, -2.f, 1.f, 1.5f), -2.f);
+        EXPECT_FLOAT_EQ(CharacterMotionCore::GreatestScale(1.f, 0.5f, 0.5f, -0.5f, 0.5f), 1.f);
+        EXPECT_FLOAT_EQ(CharacterMotionCore::GreatestScale(1.f, 1.f, -1.f, 1.f, 1.f), 1.f);
+    }
+
+    TEST(CharacterMotionCore, SprintAccelAdjust_ScalesWithVelocityAdjust)
+    {
+        EXPECT_FLOAT_EQ(CharacterMotionCore::SprintAccelAdjust(1.5f, 2.f, 2.f), 1.5f);
+        EXPECT_FLOAT_EQ(CharacterMotionCore::SprintAccelAdjust(1.5f, 2.f, 1.f), 1.f);
+        EXPECT_FLOAT_EQ(CharacterMotionCore::SprintAccelAdjust(1.5f, 0.5f, 1.f), 2.f);
+        EXPECT_FLOAT_EQ(CharacterMotionCore::SprintAccelAdjust(0.5f, 2.f, 2.f), 0.5f);
+    }
+
+    TEST_F(CharacterMotionCoreTest, Stamina_EventBitsFollowRaiseOrder)
+    {
+        // The component raises the events in ascending bit order
+        EXPECT_LT(CharacterMotionCore::StaminaEventReachedZero, CharacterMotionCore::StaminaEventCooldownStarted);
+        EXPECT_LT(CharacterMotionCore::StaminaEventCooldownStarted, CharacterMotionCore::StaminaEventCooldownDone);
+        EXPECT_LT(CharacterMotionCore::StaminaEventCooldownDone, CharacterMotionCore::StaminaEventCapped);
+    }
+
+    TEST_F(CharacterMotionCoreTest, Stamina_Depleted_ReachesZeroThenCoolsDownThenCaps)
+    {
+        EXPECT_EQ(
+            CharacterMotionCore::DrainStamina(m_staminaState, m_staminaParams, 2.f, 2.f, 0.5f), CharacterMotionCore::StaminaEventNone);
+        EXPECT_EQ(
+            CharacterMotionCore::DrainStamina(m_staminaState, m_staminaParams, 2.f, 2.f, 0.5f),
+            CharacterMotionCore::StaminaEventReachedZero);
+        EXPECT_TRUE(m_staminaState.m_decreasing);
+        EXPECT_FLOAT_EQ(CharacterMotionCore::StaminaPercentage(m_staminaState, m_staminaParams), 0.f);
+
+        EXPECT_EQ(
+            CharacterMotionCore::RecoverStamina(m_staminaState, m_staminaParams, 0.5f),
+            CharacterMotionCore::StaminaEventCooldownStarted);
+        EXPECT_FLOAT_EQ(m_staminaState.m_cooldownTimer, 1.5f);
+
+        // The cooldown finishing and the stamina capping are raised on the same tick
+        EXPECT_EQ(
+            CharacterMotionCore::RecoverStamina(m_staminaState, m_staminaParams, 1.5f),
+            CharacterMotionCore::StaminaEventCooldownDone | CharacterMotionCore::StaminaEventCapped);
+        EXPECT_TRUE(m_staminaState.m_increasing);
+        EXPECT_FLOAT_EQ(CharacterMotionCore::StaminaPercentage(m_staminaState, m_staminaParams), 100.f);
+    }
+
+    TEST_F(CharacterMotionCoreTest, Stamina_PartlySpent_RegeneratesAfterPauseThenCaps)
+    {
+        CharacterMotionCore::DrainStamina(m_staminaState, m_staminaParams, 2.f, 2.f, 0.5f);
+
+        EXPECT_EQ(CharacterMotionCore::RecoverStamina(m_staminaState, m_staminaParams, 0.5f), CharacterMotionCore::StaminaEventNone);
+        EXPECT_TRUE(m_staminaState.m_increasing);
+        EXPECT_NEAR(m_staminaState.m_heldDuration, 0.125f, 1e-5f);
+
+        EXPECT_EQ(CharacterMotionCore::RecoverStamina(m_staminaState, m_staminaParams, 0.5f), CharacterMotionCore::StaminaEventCapped);
+        EXPECT_FLOAT_EQ(m_staminaState.m_heldDuration, 0.f);
+    }
+
+    TEST(CharacterMotionCore, CreateEllipseScaledVector_Axes_ScaleByTheirDirection)
+    {
+        const auto scale = [](const AZ::Vector2& unscaledVector)
+        {
+            return CharacterMotionCore::CreateEllipseScaledVector(unscaledVector, 2.f, 0.5f, 0.75f, 1.5f);
+        };
+        EXPECT_TRUE(scale(AZ::Vector2(0.f, 1.f)).IsClose(AZ::Vector2(0.f, 2.f)));
+        EXPECT_TRUE(scale(AZ::Vector2(0.f, -1.f)).IsClose(AZ::Vector2(0.f, -0.5f)));
+        EXPECT_TRUE(scale(AZ::Vector2(-1.f, 0.f)).IsClose(AZ::Vector2(-0.75f, 0.f)));
+        EXPECT_TRUE(scale(AZ::Vector2(1.f, 0.f)).IsClose(AZ::Vector2(1.5f, 0.f)));
+    }
+
+    TEST(CharacterMotionCore, CreateEllipseScaledVector_ZeroVectorOrScales_ReturnsZero)
+    {
+        EXPECT_TRUE(CharacterMotionCore::CreateEllipseScaledVector(AZ::Vector2::CreateZero(), 1.f, 1.f, 1.f, 1.f).IsZero());
+        EXPECT_TRUE(CharacterMotionCore::CreateEllipseScaledVector(AZ::Vector2(0.5f, 0.5f), 0.f, 0.f, 0.f, 0.f).IsZero());
+    }
+
+    TEST(CharacterMotionCore, CreateEllipseScaledVector_RandomVectors_LieOnTheScaledEllipse)
+    {
+        AZ::SimpleLcgRandom random(1234);
+        for (int i = 0; i < 1000; ++i)
+        {
+            const AZ::Vector2 unscaledVector(random.GetRandomFloat() * 2.f - 1.f, random.GetRandomFloat() * 2.f - 1.f);
+            const float forwardScale = 0.1f + random.GetRandomFloat() * 2.f;
+            const float backScale = 0.1f + random.GetRandomFloat() * 2.f;
+            const float leftScale = 0.1f + random.GetRandomFloat() * 2.f;
+            const float rightScale = 0.1f + random.GetRandomFloat() * 2.f;
+
+            const AZ::Vector2 scaledVector =
+                CharacterMotionCore::CreateEllipseScaledVector(unscaledVector, forwardScale, backScale, leftScale, rightScale);
+
+            // The direction is kept and the tip lies on the quadrant's ellipse, scaled by the input's length
+            const float xScale = unscaledVector.GetX() >= 0.f ? rightScale : leftScale;
+            const float yScale = unscaledVector.GetY() >= 0.f ? forwardScale : backScale;
+            const float x = scaledVector.GetX() / xScale;
+            const float y = scaledVector.GetY() / yScale;
+            EXPECT_NEAR(x * x + y * y, unscaledVector.GetLength() * unscaledVector.GetLength(), 1e-4f);
+            EXPECT_NEAR(scaledVector.GetX() * unscaledVector.GetY(), scaledVector.GetY() * unscaledVector.GetX(), 1e-4f);
+        }
+    }
+
+    TEST_F(CharacterMotionCoreTest, LerpVelocityXY_RandomTargets_NeverOvershoot)
+    {
+        AZ::SimpleLcgRandom random(5678);
+        for (int i = 0; i < 1000; ++i)
+        {
+            SetMoving(AZ::Vector2(random.GetRandomFloat() * 8.f - 4.f, random.GetRandomFloat() * 8.f - 4.f));
+            m_state.m_lerpTime = 0.f;
+            const AZ::Vector2 prevVelocity = m_state.m_prevApplyVelocityXY;
+            const AZ::Vector2 target(random.GetRandomFloat() * 8.f - 4.f, random.GetRandomFloat() * 8.f - 4.f);
+            const float deltaTime = random.GetRandomFloat() * 0.1f;
+
+            const AZ::Vector2 velocity = CharacterMotionCore::LerpVelocityXY(m_state, m_params, m_queryResults, target, deltaTime);
+
+            // Every step moves from the previous velocity towards the target without passing it
+            EXPECT_LE(velocity.GetDistance(target), prevVelocity.GetDistance(target) + 1e-4f);
+            EXPECT_NEAR(velocity.GetDistance(prevVelocity) + velocity.GetDistance(target), prevVelocity.GetDistance(target), 1e-3f);
+        }
+    }
+
+    TEST(CharacterMotionCore, JumpMaxHoldTime_ApogeeBeyondHoldDistance_CoversHoldDistance)
+    {
+        bool apogeeInHoldDistance = true;
+        const float holdTime = CharacterMotionCore::JumpMaxHoldTime(5.f, -10.f, 1.f, apogeeInHoldDistance);
+
+        EXPECT_FALSE(apogeeInHoldDistance);
+        // The distance covered while held, v0 * t + g * t^2 / 2, is the hold distance
+        EXPECT_NEAR(5.f * holdTime - 5.f * holdTime * holdTime, 1.f, 1e-5f);
+    }
+
+    TEST(CharacterMotionCore, JumpMaxHoldTime_ApogeeWithinHoldDistance_ReturnsTimeToApogee)
+    {
+        bool apogeeInHoldDistance = false;
+        EXPECT_FLOAT_EQ(CharacterMotionCore::JumpMaxHoldTime(5.f, -10.f, 2.f, apogeeInHoldDistance), 0.5f);
+        EXPECT_TRUE(apogeeInHoldDistance);
+    }
+
+    TEST(CharacterMotionCore, GravityDeltaZ_ScalesByPhaseFactor)
+    {
+        CharacterMotionCore::GravityParams params;
+        params.m_gravity = -10.f;
+        params.m_jumpHeldGravityFactor = 0.5f;
+        params.m_jumpFallingGravityFactor = 2.f;
+
+        EXPECT_FLOAT_EQ(CharacterMotionCore::GravityDeltaZ(params, CharacterMotionCore::GravityPhase::Free, 0.1f), -1.f);
+        EXPECT_FLOAT_EQ(CharacterMotionCore::GravityDeltaZ(params, CharacterMotionCore::GravityPhase::JumpHeld, 0.1f), -0.5f);
+        EXPECT_FLOAT_EQ(CharacterMotionCore::GravityDeltaZ(params, CharacterMotionCore::GravityPhase::Falling, 0.1f), -2.f);
+    }
+
+    TEST(CharacterMotionCore, DecayLinearImpulse_Disabled_WithoutResidualVelocity_AppliesNothing)
+    {
+        CharacterMotionCore::ImpulseState state;
+        state.m_linearImpulse = AZ::Vector3(10.f, 0.f, 0.f);
+        CharacterMotionCore::ImpulseParams params;
+        params.m_enableImpulses = false;
+        CharacterMotionCore::QueryResults queryResults;
+        AZ::Vector2 applyVelocityXY(1.f, 2.f);
+        float applyVelocityZ = 3.f;
+
+        EXPECT_FALSE(CharacterMotionCore::DecayLinearImpulse(state, params, queryResults, 0.1f, applyVelocityXY, applyVelocityZ));
+        EXPECT_TRUE(state.m_linearImpulse.IsZero());
+        EXPECT_TRUE(applyVelocityXY.IsClose(AZ::Vector2(1.f, 2.f)));
+        EXPECT_FLOAT_EQ(applyVelocityZ, 3.f);
+    }
+
+    TEST(CharacterMotionCore, DecayLinearImpulse_GroundFriction_DeceleratesToRest)
+    {
+        CharacterMotionCore::ImpulseState state;
+        state.m_linearImpulse = AZ::Vector3(10.f, 0.f, 0.f);
+        CharacterMotionCore::ImpulseParams params;
+        params.m_characterMass = 2.f;
+        params.m_gravity = -10.f;
+        CharacterMotionCore::QueryResults queryResults;
+        queryResults.m_groundHit = true;
+        queryResults.m_groundDynamicFriction = 0.5f;
+        AZ::Vector2 applyVelocityXY = AZ::Vector2::CreateZero();
+        float applyVelocityZ = 0.f;
+
+        // 5 m/s from the impulse decelerating at 5 m/s^2 comes to rest after one second
+        EXPECT_TRUE(CharacterMotionCore::DecayLinearImpulse(state, params, queryResults, 0.5f, applyVelocityXY, applyVelocityZ));
+        EXPECT_TRUE(applyVelocityXY.IsClose(AZ::Vector2(5.f, 0.f)));
+        EXPECT_FLOAT_EQ(state.m_totalLerpTime, 1.f);
+        EXPECT_TRUE(state.m_linearImpulse.IsZero());
+
+        EXPECT_TRUE(CharacterMotionCore::DecayLinearImpulse(state, params, queryResults, 0.5f, applyVelocityXY, applyVelocityZ));
+        EXPECT_TRUE(applyVelocityXY.IsClose(AZ::Vector2(2.5f, 0.f)));
+        EXPECT_TRUE(state.m_velocityFromImpulse.IsZero());
+    }
+
+    TEST(CharacterMotionCore, DecayLinearImpulse_ImpulseZ_IsAppliedOnce)
+    {
+        CharacterMotionCore::ImpulseState state;
+        state.m_linearImpulse = AZ::Vector3(0.f, 0.f, 4.f);
+        CharacterMotionCore::ImpulseParams params;
+        params.m_decelUsesFriction = false;
+        CharacterMotionCore::QueryResults queryResults;
+        AZ::Vector2 applyVelocityXY = AZ::Vector2::CreateZero();
+        float applyVelocityZ = 1.f;
+
+        EXPECT_TRUE(CharacterMotionCore::DecayLinearImpulse(state, params, queryResults, 0.1f, applyVelocityXY, applyVelocityZ));
+        EXPECT_FLOAT_EQ(applyVelocityZ, 5.f);
+        EXPECT_FLOAT_EQ(state.m_velocityFromImpulse.GetZ(), 0.f);
+    }
+
+    TEST_F(CharacterMotionCoreTest, Stamina_RandomSprinting_StaysWithinRange)
+    {
+        AZ::SimpleLcgRandom random(91011);
+        for (int i = 0; i < 10000; ++i)
+        {
+            const float deltaTime = random.GetRandomFloat() * 0.1f;
+            if (random.GetRandomFloat() < 0.5f)
+                CharacterMotionCore::DrainStamina(m_staminaState, m_staminaParams, 1.f + random.GetRandomFloat(), 2.f, deltaTime);
+            else
+                CharacterMotionCore::RecoverStamina(m_staminaState, m_staminaParams, deltaTime);
+
+            const float staminaPercentage = CharacterMotionCore::StaminaPercentage(m_staminaState, m_staminaParams);
+            EXPECT_GE(staminaPercentage, 0.f);
+            EXPECT_LE(staminaPercentage, 100.f);
+            EXPECT_GE(m_staminaState.m_cooldownTimer, 0.f);
+        }
+    }
+} // namespace UnitTest
+
+AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
@@ -41,10 +41,30 @@ set(FILES
     Source/Clients/FirstPersonExtrasComponent.h
     Source/Clients/CameraCoupledChildComponent.cpp
     Source/Clients/CameraCoupledChildComponent.h
+    Source/Clients/CameraPoseCompositor.cpp
+    Source/Clients/CameraPoseCompositor.h
+    Source/Clients/CharacterMotionCore.cpp
+    Source/Clients/CharacterMotionCore.h
+    Source/Clients/FirstPersonControllerBenchmark.cpp
+    Source/Clients/FirstPersonControllerBenchmark.h
+    Source/Clients/FirstPersonControllerStats.h
+    Source/Clients/FrameStageGraph.cpp
+    Source/Clients/FrameStageGraph.h
+    Source/Clients/InputEventDispatchTable.h
+    Source/Clients/InputTrace.cpp
+    Source/Clients/InputTrace.h
+    Source/Clients/RawMouseLookAccumulator.cpp
+    Source/Clients/RawMouseLookAccumulator.h
+    Source/Clients/SceneQueryBatch.cpp
+    Source/Clients/SceneQueryBatch.h
     Source/Multiplayer/NetworkFPC.cpp
     Source/Multiplayer/NetworkFPC.h
     Source/Multiplayer/NetworkFPCBotAnimation.cpp
     Source/Multiplayer/NetworkFPCBotAnimation.h
+    Source/Multiplayer/NetworkFPCPropertyStats.cpp
+    Source/Multiplayer/NetworkFPCPropertyStats.h
+    Source/Multiplayer/NetworkFPCRedundantInputs.cpp
+    Source/Multiplayer/NetworkFPCRedundantInputs.h
 
     Source/AutoGen/NetworkFPC.AutoComponent.xml
     Source/AutoGen/NetworkFPCBotAnimation.AutoComponent.xml
@@ -61,5 +81,21 @@ set(FILES
     Source/Clients/FirstPersonExtrasComponent.h
     Source/Clients/CameraCoupledChildComponent.cpp
     Source/Clients/CameraCoupledChildComponent.h
+    Source/Clients/CameraPoseCompositor.cpp
+    Source/Clients/CameraPoseCompositor.h
+    Source/Clients/CharacterMotionCore.cpp
+    Source/Clients/CharacterMotionCore.h
+    Source/Clients/FirstPersonControllerBenchmark.cpp
+    Source/Clients/FirstPersonControllerBenchmark.h
+    Source/Clients/FirstPersonControllerStats.h
+    Source/Clients/FrameStageGraph.cpp
+    Source/Clients/FrameStageGraph.h
+    Source/Clients/InputEventDispatchTable.h
+    Source/Clients/InputTrace.cpp
+    Source/Clients/InputTrace.h
+    Source/Clients/RawMouseLookAccumulator.cpp
+    Source/Clients/RawMouseLookAccumulator.h
+    Source/Clients/SceneQueryBatch.cpp
+    Source/Clients/SceneQueryBatch.h
 )
 endif()
@@ -1,4 +1,5 @@
 
 set(FILES
+    Tests/Clients/CharacterMotionCoreBenchmarks.cpp
     Tests/Clients/FirstPersonControllerTest.cpp
 )